@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef BENCHMARK_ALLOCATION_COUNTER_H_
+#define BENCHMARK_ALLOCATION_COUNTER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+
+/**
+ * Counts the heap allocations of a benchmark executable. The global
+ * operator new is replaced in AllocationCounter.cpp, which is compiled into
+ * each benchmark executable that includes this header.
+ */
+namespace uprotocol::benchmark {
+
+/**
+ * Number of calls to the global operator new.
+ */
+extern std::atomic<uint64_t> allocationCount;
+
+/**
+ * Report the allocations done by each iteration of a benchmark.
+ * @param state Benchmark state.
+ * @param start allocationCount when the benchmark loop started.
+ */
+inline auto reportAllocations(::benchmark::State& state, uint64_t start) -> void {
+    state.counters["allocs/iter"] = ::benchmark::Counter(
+        static_cast<double>(allocationCount.load() - start),
+        ::benchmark::Counter::kAvgIterations);
+}
+
+} // namespace uprotocol::benchmark
+
+#endif // BENCHMARK_ALLOCATION_COUNTER_H_
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <up-cpp/uri/builder/BuildUAuthority.h>
+#include <up-cpp/uri/serializer/IpAddress.h>
+
+using namespace uprotocol::uri;
+using uprotocol::benchmark::allocationCount;
+using uprotocol::benchmark::reportAllocations;
+
+static const std::string IpV4 = "192.168.1.100";
+static const std::string IpV6 = "2001:db8:85a3::8a2e:370:7334";
+
+static void BM_ParseIpAddress(benchmark::State& state, const std::string& address) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        IpAddress ip(address);
+        benchmark::DoNotOptimize(ip);
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_SetIp(benchmark::State& state, const std::string& address) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BuildUAuthority().setIp(address).build());
+    }
+    reportAllocations(state, start);
+}
+
+BENCHMARK_CAPTURE(BM_ParseIpAddress, IpV4, IpV4);
+BENCHMARK_CAPTURE(BM_ParseIpAddress, IpV6, IpV6);
+BENCHMARK_CAPTURE(BM_SetIp, IpV4, IpV4);
+BENCHMARK_CAPTURE(BM_SetIp, IpV6, IpV6);
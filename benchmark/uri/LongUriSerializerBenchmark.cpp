@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/serializer/UriTokenizer.h>
+#include <up-cpp/uri/tools/Utils.h>
+#include <up-cpp/uri/validator/LongUriValidator.h>
+
+using namespace uprotocol::uri;
+using uprotocol::benchmark::allocationCount;
+using uprotocol::benchmark::reportAllocations;
+
+static const std::string LocalUri = "/body.access/1/door.front_left#Door";
+static const std::string RemoteUri = "//vcu.my_car_vin/body.access/1/door.front_left#Door";
+
+/**
+ * The split() LongUriSerializer used before UriTokenizer, kept as the baseline.
+ */
+static auto legacySplit(std::string str, const std::string_view& delimiter) -> std::vector<std::string> {
+    std::vector<std::string> vec;
+    std::string token;
+    auto pos = str.find(delimiter);
+    while (std::string::npos != pos) {
+        token = str.substr(0, pos);
+        vec.push_back(token);
+        str.erase(0, pos + delimiter.length());
+        pos = str.find(delimiter);
+    }
+    vec.push_back(str);
+
+    return vec;
+}
+
+static void BM_LegacySplit(benchmark::State& state, const std::string& uri) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        auto copy = uri;
+        std::replace(copy.begin(), copy.end(), '\\', '/');
+        benchmark::DoNotOptimize(legacySplit(copy, "/"));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_UriTokenizer(benchmark::State& state, const std::string& uri) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        UriTokenizer tokens(uri);
+        benchmark::DoNotOptimize(tokens);
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_Deserialize(benchmark::State& state, const std::string& uri) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LongUriSerializer::deserialize(uri));
+    }
+    reportAllocations(state, start);
+}
+
+/**
+ * What valid_uri did before LongUriValidator, kept as the baseline.
+ */
+static void BM_ValidByDeserialize(benchmark::State& state, const std::string& uri) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(!isEmpty(LongUriSerializer::deserialize(uri)));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_LongUriValidator(benchmark::State& state, const std::string& uri) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LongUriValidator::isValid(uri));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_Serialize(benchmark::State& state, const std::string& uri) {
+    const auto u_uri = LongUriSerializer::deserialize(uri);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LongUriSerializer::serialize(u_uri));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_SerializeReusedBuffer(benchmark::State& state, const std::string& uri) {
+    const auto u_uri = LongUriSerializer::deserialize(uri);
+    std::string out;
+    LongUriSerializer::serialize(u_uri, out);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        LongUriSerializer::serialize(u_uri, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    reportAllocations(state, start);
+}
+
+BENCHMARK_CAPTURE(BM_LegacySplit, local, LocalUri);
+BENCHMARK_CAPTURE(BM_LegacySplit, remote, RemoteUri);
+BENCHMARK_CAPTURE(BM_UriTokenizer, local, LocalUri);
+BENCHMARK_CAPTURE(BM_UriTokenizer, remote, RemoteUri);
+BENCHMARK_CAPTURE(BM_Deserialize, local, LocalUri);
+BENCHMARK_CAPTURE(BM_Deserialize, remote, RemoteUri);
+BENCHMARK_CAPTURE(BM_ValidByDeserialize, local, LocalUri);
+BENCHMARK_CAPTURE(BM_ValidByDeserialize, remote, RemoteUri);
+BENCHMARK_CAPTURE(BM_LongUriValidator, local, LocalUri);
+BENCHMARK_CAPTURE(BM_LongUriValidator, remote, RemoteUri);
+BENCHMARK_CAPTURE(BM_Serialize, local, LocalUri);
+BENCHMARK_CAPTURE(BM_Serialize, remote, RemoteUri);
+BENCHMARK_CAPTURE(BM_SerializeReusedBuffer, local, LocalUri);
+BENCHMARK_CAPTURE(BM_SerializeReusedBuffer, remote, RemoteUri);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <up-cpp/uri/matcher/MicroUriDispatchTable.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+using uprotocol::benchmark::allocationCount;
+using uprotocol::benchmark::reportAllocations;
+
+/**
+ * count local URIs, 16 resources per entity.
+ */
+static auto makeUris(std::size_t count) -> std::vector<MicroUri> {
+    std::vector<MicroUri> uris;
+    uris.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        uris.push_back(MicroUri::local(static_cast<uint16_t>(0x100 + i / 16), 1,
+                                       static_cast<uint16_t>(0x8000 + i % 16)));
+    }
+    return uris;
+}
+
+static auto serialize(const MicroUri& uri) -> std::vector<uint8_t> {
+    std::vector<uint8_t> bytes(MicroUri::LocalLength);
+    uri.serialize(bytes.data(), bytes.size());
+    return bytes;
+}
+
+/**
+ * Dispatch through a UUri and a locked map, as a receive path without the table would.
+ */
+static void BM_UUriMapDispatch(benchmark::State& state) {
+    const auto uris = makeUris(static_cast<std::size_t>(state.range(0)));
+    std::mutex mutex;
+    std::unordered_map<uint64_t, std::vector<std::size_t>> listeners;
+    for (std::size_t i = 0; i < uris.size(); ++i) {
+        listeners[uris[i].key()].push_back(i);
+    }
+    const auto bytes = serialize(uris.back());
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        const auto u_uri = MicroUriSerializer::deserialize(bytes.data(), bytes.size());
+        const auto key = MicroUri::makeKey(static_cast<uint16_t>(u_uri.entity().id()),
+                                           static_cast<uint8_t>(u_uri.entity().version_major()),
+                                           static_cast<uint16_t>(u_uri.resource().id()));
+        std::size_t calls = 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto it = listeners.find(key); it != listeners.end()) {
+            for (auto listener : it->second) {
+                calls += listener;
+            }
+        }
+        benchmark::DoNotOptimize(calls);
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_MicroUriDispatchTable(benchmark::State& state) {
+    const auto uris = makeUris(static_cast<std::size_t>(state.range(0)));
+    MicroUriDispatchTable<std::size_t> table;
+    for (std::size_t i = 0; i < uris.size(); ++i) {
+        table.add(uris[i], i);
+    }
+    const auto bytes = serialize(uris.back());
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        std::size_t calls = 0;
+        table.dispatch(bytes.data(), bytes.size(), [&calls](std::size_t listener) { calls += listener; });
+        benchmark::DoNotOptimize(calls);
+    }
+    reportAllocations(state, start);
+}
+
+BENCHMARK(BM_UUriMapDispatch)->Arg(64)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_MicroUriDispatchTable)->Arg(64)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_MicroUriDispatchTable)->Arg(1024)->Threads(4);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+using uprotocol::benchmark::allocationCount;
+using uprotocol::benchmark::reportAllocations;
+
+static auto makeUri(const uprotocol::v1::UAuthority& authority) -> uprotocol::v1::UUri {
+    return BuildUUri()
+        .setAutority(authority)
+        .setEntity(BuildUEntity().setId(0x1234).setMajorVersion(1).build())
+        .setResource(BuildUResource().setID(0x0102).build())
+        .build();
+}
+
+static const auto LocalUri = makeUri(BuildUAuthority().build());
+static const auto IpV4Uri = makeUri(BuildUAuthority().setIp("192.168.1.100").build());
+static const auto IpV6Uri = makeUri(BuildUAuthority().setIp("2001:db8:85a3::8a2e:370:7334").build());
+static const auto IdUri = makeUri(BuildUAuthority().setId("vcu.my_car_vin").build());
+
+static void BM_Serialize(benchmark::State& state, const uprotocol::v1::UUri& uri) {
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MicroUriSerializer::serialize(uri));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_Deserialize(benchmark::State& state, const uprotocol::v1::UUri& uri) {
+    const auto micro_uri = MicroUriSerializer::serialize(uri);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MicroUriSerializer::deserialize(micro_uri));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_SerializeInto(benchmark::State& state, const uprotocol::v1::UUri& uri) {
+    std::array<uint8_t, MicroUriSerializer::MaxMicroUriLength> micro_uri{};
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MicroUriSerializer::serializeInto(uri, micro_uri.data(), micro_uri.size()));
+    }
+    reportAllocations(state, start);
+}
+
+/**
+ * Read the ids of a micro URI as a MicroUri, without a UUri.
+ */
+static void BM_ParseMicroUri(benchmark::State& state, const uprotocol::v1::UUri& uri) {
+    const auto micro_uri = MicroUriSerializer::serialize(uri);
+    MicroUri parsed;
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        MicroUri::parse(micro_uri.data(), micro_uri.size(), parsed);
+        benchmark::DoNotOptimize(parsed.key());
+    }
+    reportAllocations(state, start);
+}
+
+/**
+ * A frame of local micro URIs, back to back.
+ */
+static auto makeFrame(std::size_t count) -> std::vector<uint8_t> {
+    std::vector<uint8_t> frame;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto uri = MicroUri::local(static_cast<uint16_t>(0x100 + i), 1, static_cast<uint16_t>(0x8000 + i));
+        std::array<uint8_t, MicroUri::LocalLength> bytes{};
+        uri.serialize(bytes.data(), bytes.size());
+        frame.insert(frame.end(), bytes.begin(), bytes.end());
+    }
+    return frame;
+}
+
+static void BM_DeserializeFrame(benchmark::State& state) {
+    const std::size_t count = state.range(0);
+    const auto frame = makeFrame(count);
+    std::vector<uint16_t> entity_ids(count);
+    std::vector<uint16_t> resource_ids(count);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            auto u_uri = MicroUriSerializer::deserialize(&frame[i * MicroUri::LocalLength], MicroUri::LocalLength);
+            entity_ids[i] = static_cast<uint16_t>(u_uri.entity().id());
+            resource_ids[i] = static_cast<uint16_t>(u_uri.resource().id());
+        }
+        benchmark::DoNotOptimize(entity_ids.data());
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_DeserializeLocalBatch(benchmark::State& state, MicroUriSerializer::BatchKernel kernel) {
+    if (!MicroUriSerializer::setBatchKernel(kernel)) {
+        state.SkipWithError("kernel not supported by the CPU");
+        return;
+    }
+    const std::size_t count = state.range(0);
+    const auto frame = makeFrame(count);
+    std::vector<uint16_t> entity_ids(count);
+    std::vector<uint8_t> versions(count);
+    std::vector<uint16_t> resource_ids(count);
+    std::vector<uint64_t> invalid((count + 63) / 64);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MicroUriSerializer::deserializeLocalBatch(
+            frame.data(), count, entity_ids.data(), versions.data(), resource_ids.data(), invalid.data()));
+    }
+    reportAllocations(state, start);
+}
+
+BENCHMARK_CAPTURE(BM_Serialize, Local, LocalUri);
+BENCHMARK_CAPTURE(BM_Serialize, IpV4, IpV4Uri);
+BENCHMARK_CAPTURE(BM_Serialize, IpV6, IpV6Uri);
+BENCHMARK_CAPTURE(BM_Serialize, Id, IdUri);
+BENCHMARK_CAPTURE(BM_SerializeInto, Local, LocalUri);
+BENCHMARK_CAPTURE(BM_SerializeInto, IpV4, IpV4Uri);
+BENCHMARK_CAPTURE(BM_SerializeInto, IpV6, IpV6Uri);
+BENCHMARK_CAPTURE(BM_SerializeInto, Id, IdUri);
+BENCHMARK_CAPTURE(BM_Deserialize, Local, LocalUri);
+BENCHMARK_CAPTURE(BM_Deserialize, IpV4, IpV4Uri);
+BENCHMARK_CAPTURE(BM_Deserialize, IpV6, IpV6Uri);
+BENCHMARK_CAPTURE(BM_Deserialize, Id, IdUri);
+BENCHMARK_CAPTURE(BM_ParseMicroUri, Local, LocalUri);
+BENCHMARK_CAPTURE(BM_ParseMicroUri, IpV6, IpV6Uri);
+BENCHMARK_CAPTURE(BM_ParseMicroUri, Id, IdUri);
+BENCHMARK(BM_DeserializeFrame)->Arg(256);
+BENCHMARK_CAPTURE(BM_DeserializeLocalBatch, Scalar, MicroUriSerializer::BatchKernel::Scalar)->Arg(256);
+BENCHMARK_CAPTURE(BM_DeserializeLocalBatch, Sse41, MicroUriSerializer::BatchKernel::Sse41)->Arg(256);
+BENCHMARK_CAPTURE(BM_DeserializeLocalBatch, Avx2, MicroUriSerializer::BatchKernel::Avx2)->Arg(256);
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <up-cpp/uri/resolver/UriCatalogue.h>
+
+using namespace uprotocol::uri;
+using uprotocol::benchmark::allocationCount;
+using uprotocol::benchmark::reportAllocations;
+
+static const std::string CataloguePath = "uri_catalogue_benchmark.bin";
+
+static auto makeEntities(std::size_t count) -> std::vector<UriCatalogue::EntityMapping> {
+    std::vector<UriCatalogue::EntityMapping> entities;
+    for (uint16_t i = 1; i <= count; ++i) {
+        entities.push_back({"service" + std::to_string(i), i});
+    }
+    return entities;
+}
+
+static auto makeResources(std::size_t count) -> std::vector<UriCatalogue::ResourceMapping> {
+    std::vector<UriCatalogue::ResourceMapping> resources;
+    for (uint16_t i = 1; i <= count; ++i) {
+        resources.push_back({i, "door.front_left#Door", 1});
+        resources.push_back({i, "door.front_right#Door", 2});
+    }
+    return resources;
+}
+
+/**
+ * Startup with tables built in memory: grows with the number of entities.
+ */
+static void BM_BuildResolver(benchmark::State& state) {
+    const auto entities = makeEntities(state.range(0));
+    const auto resources = makeResources(state.range(0));
+    for (auto _ : state) {
+        UriResolver resolver(entities, resources);
+        benchmark::DoNotOptimize(resolver.entityId("service1"));
+    }
+}
+
+/**
+ * Startup with a mapped catalogue: the same for any number of entities.
+ */
+static void BM_OpenCatalogue(benchmark::State& state) {
+    UriCatalogue::write(CataloguePath, makeEntities(state.range(0)), makeResources(state.range(0)));
+    for (auto _ : state) {
+        auto catalogue = UriCatalogue::open(CataloguePath);
+        benchmark::DoNotOptimize(catalogue->resolve("service1"));
+    }
+    std::remove(CataloguePath.c_str());
+}
+
+static void BM_CatalogueResolve(benchmark::State& state) {
+    UriCatalogue::write(CataloguePath, makeEntities(1000), makeResources(1000));
+    const auto catalogue = UriCatalogue::open(CataloguePath);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        const auto entity_id = catalogue->resolve("service500");
+        benchmark::DoNotOptimize(catalogue->resolve(*entity_id, "door.front_left"));
+        benchmark::DoNotOptimize(catalogue->reverse(*entity_id, 2));
+    }
+    reportAllocations(state, start);
+    std::remove(CataloguePath.c_str());
+}
+
+BENCHMARK(BM_BuildResolver)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_OpenCatalogue)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CatalogueResolve);
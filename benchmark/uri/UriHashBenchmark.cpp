@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/tools/UriHash.h>
+#include <up-cpp/uri/tools/Utils.h>
+
+using namespace uprotocol::uri;
+using uprotocol::v1::UUri;
+
+/**
+ * Routing table of count remote topics.
+ */
+static auto makeRoutes(std::size_t count) -> std::vector<UUri> {
+    std::vector<UUri> routes;
+    routes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        routes.push_back(LongUriSerializer::deserialize(
+            "//vcu.my_car_vin/body.access/1/door" + std::to_string(i) + ".front_left#Door"));
+    }
+    return routes;
+}
+
+/**
+ * Lookup with the operator== of Utils.h, the current comparison path.
+ */
+static void BM_LinearScan(benchmark::State& state) {
+    const auto routes = makeRoutes(static_cast<std::size_t>(state.range(0)));
+    const auto& key = routes.back();
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < routes.size(); ++i) {
+            if (routes[i] == key) {
+                found = i;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+static void BM_HashMapFind(benchmark::State& state) {
+    const auto routes = makeRoutes(static_cast<std::size_t>(state.range(0)));
+    std::unordered_map<UUri, std::size_t, UriHash, UriEqual> table;
+    for (std::size_t i = 0; i < routes.size(); ++i) {
+        table.emplace(routes[i], i);
+    }
+    const auto& key = routes.back();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.find(key));
+    }
+}
+
+static void BM_HashUri(benchmark::State& state) {
+    const auto uri = makeRoutes(1).front();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UriHash()(uri));
+    }
+}
+
+static void BM_HashLongUri(benchmark::State& state) {
+    const auto long_uri = LongUriSerializer::serialize(makeRoutes(1).front());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UriHash()(long_uri));
+    }
+}
+
+/**
+ * Compare a UUri with a long format string by serializing it.
+ */
+static void BM_EqualBySerialize(benchmark::State& state) {
+    const auto uri = makeRoutes(1).front();
+    const auto long_uri = LongUriSerializer::serialize(uri);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LongUriSerializer::serialize(uri) == long_uri);
+    }
+}
+
+static void BM_EqualLongUri(benchmark::State& state) {
+    const auto uri = makeRoutes(1).front();
+    const auto long_uri = LongUriSerializer::serialize(uri);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UriEqual()(uri, long_uri));
+    }
+}
+
+BENCHMARK(BM_LinearScan)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_HashMapFind)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_HashUri);
+BENCHMARK(BM_HashLongUri);
+BENCHMARK(BM_EqualBySerialize);
+BENCHMARK(BM_EqualLongUri);
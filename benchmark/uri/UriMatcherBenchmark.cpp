@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <up-cpp/uri/matcher/UriMatcher.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/tools/Utils.h>
+
+using namespace uprotocol::uri;
+using uprotocol::v1::UUri;
+
+/**
+ * count patterns, a quarter of them covering a whole entity.
+ */
+static auto makePatterns(std::size_t count) -> std::vector<UUri> {
+    std::vector<UUri> patterns;
+    patterns.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto entity = "/service" + std::to_string(i / 4);
+        patterns.push_back(LongUriSerializer::deserialize(
+            0 == i % 4 ? entity : entity + "/1/topic" + std::to_string(i)));
+    }
+    return patterns;
+}
+
+/**
+ * Dispatch by testing every pattern with the operator== of Utils.h.
+ */
+static void BM_LinearDispatch(benchmark::State& state) {
+    const auto patterns = makePatterns(static_cast<std::size_t>(state.range(0)));
+    const auto uri = patterns.back();
+    for (auto _ : state) {
+        std::size_t matches = 0;
+        for (const auto& pattern : patterns) {
+            matches += pattern == uri ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+}
+
+static void BM_UriMatcher(benchmark::State& state) {
+    const auto patterns = makePatterns(static_cast<std::size_t>(state.range(0)));
+    UriMatcher<std::size_t> matcher;
+    for (std::size_t i = 0; i < patterns.size(); ++i) {
+        matcher.add(patterns[i], i);
+    }
+    const auto uri = patterns.back();
+    for (auto _ : state) {
+        std::size_t matches = 0;
+        matcher.forEachMatch(uri, [&matches](std::size_t) { ++matches; });
+        benchmark::DoNotOptimize(matches);
+    }
+}
+
+BENCHMARK(BM_LinearDispatch)->Arg(64)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_UriMatcher)->Arg(64)->Arg(1024)->Arg(16384);
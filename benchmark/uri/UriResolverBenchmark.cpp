@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <up-cpp/uri/resolver/UriResolver.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+using uprotocol::benchmark::allocationCount;
+using uprotocol::benchmark::reportAllocations;
+
+static const std::string LongUri = "/body.access/1/door.front_left#Door";
+
+static auto makeResolver() -> UriResolver {
+    std::vector<UriResolver::EntityMapping> entities;
+    std::vector<UriResolver::ResourceMapping> resources;
+    for (uint16_t i = 1; i <= 1000; ++i) {
+        entities.push_back({"service" + std::to_string(i), i});
+        resources.push_back({i, "topic" + std::to_string(i), 1});
+    }
+    entities.push_back({"body.access", 0x1234});
+    resources.push_back({0x1234, "door.front_left#Door", 0x0102});
+    return UriResolver(entities, resources);
+}
+
+/**
+ * Deserialize, resolve the names by hand, serialize: the path without UriResolver.
+ */
+static void BM_DeserializeResolveSerialize(benchmark::State& state) {
+    const auto resolver = makeResolver();
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        auto u_uri = LongUriSerializer::deserialize(LongUri);
+        const auto* entity_id = resolver.entityId(u_uri.entity().name());
+        u_uri.mutable_entity()->set_id(*entity_id);
+        u_uri.mutable_resource()->set_id(*resolver.resourceId(*entity_id, "door.front_left"));
+        benchmark::DoNotOptimize(MicroUriSerializer::serialize(u_uri));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_ToMicro(benchmark::State& state) {
+    const auto resolver = makeResolver();
+    std::vector<uint8_t> micro;
+    resolver.toMicro(LongUri, micro);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(resolver.toMicro(LongUri, micro));
+    }
+    reportAllocations(state, start);
+}
+
+static void BM_ToLong(benchmark::State& state) {
+    const auto resolver = makeResolver();
+    const auto micro = resolver.toMicro(LongUri);
+    std::string long_uri;
+    resolver.toLong(micro.data(), micro.size(), long_uri);
+    const auto start = allocationCount.load();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(resolver.toLong(micro.data(), micro.size(), long_uri));
+    }
+    reportAllocations(state, start);
+}
+
+BENCHMARK(BM_DeserializeResolveSerialize);
+BENCHMARK(BM_ToMicro);
+BENCHMARK(BM_ToLong);
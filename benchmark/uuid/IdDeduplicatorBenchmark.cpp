@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <set>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <up-cpp/uuid/dedup/IdDeduplicator.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+#include <up-cpp/uuid/serializer/UuidSerializer.h>
+
+using namespace uprotocol::uuid;
+
+static constexpr std::size_t Window = 65536;
+
+/**
+ * Baseline: what listeners do today, a set of serialized ids trimmed to
+ * the same number of ids.
+ */
+static void BM_StringSet(benchmark::State& state) {
+    std::vector<RawUuid> ids(Window * 4);
+    Uuidv8Factory::createBatch(ids.size(), ids.data());
+    std::set<std::string> seen;
+    std::size_t n = 0;
+    for (auto _ : state) {
+        auto id = Uuidv8Factory::toUUID(ids[n++ % ids.size()]);
+        auto str = UuidSerializer::serializeToString(id);
+        benchmark::DoNotOptimize(seen.insert(str).second);
+        if (seen.size() > Window) {
+            seen.erase(seen.begin());
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Insert of ids, half of them duplicates.
+ */
+static void BM_Insert(benchmark::State& state) {
+    std::vector<RawUuid> ids(Window * 4);
+    Uuidv8Factory::createBatch(ids.size(), ids.data());
+    IdDeduplicator dedup(std::chrono::hours(1), Window);
+    std::size_t n = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dedup.insert(ids[(n++ / 2) % ids.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["fp_rate"] = dedup.falsePositiveRate();
+}
+
+/**
+ * Lock-free lookups of a full cache, from every benchmark thread.
+ */
+static void BM_Contains(benchmark::State& state) {
+    static std::vector<RawUuid> ids(Window);
+    static IdDeduplicator dedup(std::chrono::hours(1), Window);
+    if (0 == state.thread_index()) {
+        Uuidv8Factory::createBatch(ids.size(), ids.data());
+        for (const auto &id : ids) {
+            dedup.insert(id);
+        }
+    }
+    std::size_t n = state.thread_index();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dedup.contains(ids[n++ % ids.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_StringSet);
+BENCHMARK(BM_Insert);
+BENCHMARK(BM_Contains)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <up-cpp/uuid/factory/RandomGen.h>
+
+/**
+ * The RandomGenerator::GenerateRandom() used before the per thread engines,
+ * kept as the baseline.
+ */
+static uint64_t legacyGenerateRandom() {
+    std::random_device dev;
+    std::mt19937 rng(dev());
+    std::uniform_int_distribution<std::mt19937::result_type> dist_64(1, UINT64_MAX);
+
+    return dist_64(rng);
+}
+
+static void BM_LegacyGenerateRandom(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacyGenerateRandom());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_GenerateRandom(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(RandomGenerator::GenerateRandom());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Fill(benchmark::State& state) {
+    std::vector<uint64_t> values(state.range(0));
+    for (auto _ : state) {
+        RandomGenerator::fill(values.data(), values.size());
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_LegacyGenerateRandom);
+BENCHMARK(BM_GenerateRandom);
+BENCHMARK(BM_Fill)->Arg(16)->Arg(256);
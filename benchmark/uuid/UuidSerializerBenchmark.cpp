@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+#include <up-cpp/uuid/serializer/UuidSerializer.h>
+
+using namespace uprotocol::uuid;
+
+static constexpr std::size_t Count = 4096;
+
+/**
+ * Throughput of one UUID at a time through the allocating API, as the baseline.
+ * bytes_per_second counts the characters of the String format.
+ */
+static void BM_SerializeToString(benchmark::State& state) {
+    std::vector<UUID> uuids(Count);
+    for (auto &uuid : uuids) {
+        uuid = Uuidv8Factory::create();
+    }
+    for (auto _ : state) {
+        for (const auto &uuid : uuids) {
+            benchmark::DoNotOptimize(UuidSerializer::serializeToString(uuid));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * Count * UuidSerializer::StringLength);
+}
+
+static void BM_DeserializeFromString(benchmark::State& state) {
+    std::vector<std::string> strings(Count);
+    for (auto &str : strings) {
+        str = UuidSerializer::serializeToString(Uuidv8Factory::create());
+    }
+    for (auto _ : state) {
+        for (const auto &str : strings) {
+            benchmark::DoNotOptimize(UuidSerializer::deserializeFromString(str));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * Count * UuidSerializer::StringLength);
+}
+
+static void BM_SerializeToStrings(benchmark::State& state, UuidSerializer::HexKernel kernel) {
+    if (!UuidSerializer::setHexKernel(kernel)) {
+        state.SkipWithError("kernel not supported by the CPU");
+        return;
+    }
+    std::vector<RawUuid> uuids(Count);
+    Uuidv8Factory::createBatch(Count, uuids.data());
+    std::vector<char> out(Count * UuidSerializer::StringLength);
+    for (auto _ : state) {
+        UuidSerializer::serializeToStrings(uuids.data(), Count, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * Count * UuidSerializer::StringLength);
+}
+
+static void BM_DeserializeFromStrings(benchmark::State& state, UuidSerializer::HexKernel kernel) {
+    if (!UuidSerializer::setHexKernel(kernel)) {
+        state.SkipWithError("kernel not supported by the CPU");
+        return;
+    }
+    std::vector<RawUuid> uuids(Count);
+    Uuidv8Factory::createBatch(Count, uuids.data());
+    std::vector<char> in(Count * UuidSerializer::StringLength);
+    UuidSerializer::serializeToStrings(uuids.data(), Count, in.data());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UuidSerializer::deserializeFromStrings(in.data(), Count, uuids.data()));
+    }
+    state.SetBytesProcessed(state.iterations() * Count * UuidSerializer::StringLength);
+}
+
+BENCHMARK(BM_SerializeToString);
+BENCHMARK_CAPTURE(BM_SerializeToStrings, scalar, UuidSerializer::HexKernel::Scalar);
+BENCHMARK_CAPTURE(BM_SerializeToStrings, sse41, UuidSerializer::HexKernel::Sse41);
+BENCHMARK_CAPTURE(BM_SerializeToStrings, avx2, UuidSerializer::HexKernel::Avx2);
+BENCHMARK(BM_DeserializeFromString);
+BENCHMARK_CAPTURE(BM_DeserializeFromStrings, scalar, UuidSerializer::HexKernel::Scalar);
+BENCHMARK_CAPTURE(BM_DeserializeFromStrings, sse41, UuidSerializer::HexKernel::Sse41);
+BENCHMARK_CAPTURE(BM_DeserializeFromStrings, avx2, UuidSerializer::HexKernel::Avx2);
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+
+using namespace uprotocol::uuid;
+
+/**
+ * Generate one UUID per iteration on every benchmark thread, in the given mode.
+ * Compare the items_per_second of Threads(1) and Threads(N) to see the scaling.
+ */
+static void BM_Create(benchmark::State& state, Uuidv8Factory::Mode mode) {
+    if (0 == state.thread_index()) {
+        Uuidv8Factory::setMode(mode);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Uuidv8Factory::create());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Generate a batch of raw UUIDs per iteration on every benchmark thread.
+ */
+static void BM_CreateBatch(benchmark::State& state, Uuidv8Factory::Mode mode) {
+    if (0 == state.thread_index()) {
+        Uuidv8Factory::setMode(mode);
+    }
+    std::vector<RawUuid> ids(state.range(0));
+    for (auto _ : state) {
+        Uuidv8Factory::createBatch(ids.size(), ids.data());
+        benchmark::DoNotOptimize(ids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Read the time of the given clock.
+ */
+static void BM_Now(benchmark::State& state, Uuidv8Factory::Clock clock) {
+    Uuidv8Factory::setClock(clock);
+    Uuidv8Factory::setManualTime(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Uuidv8Factory::now());
+    }
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Generate one raw UUID per iteration with the given clock. The counter
+ * overflow borrows ticks, as waiting on the manual clock would never end.
+ */
+static void BM_CreateWithClock(benchmark::State& state, Uuidv8Factory::Clock clock) {
+    Uuidv8Factory::setClock(clock);
+    Uuidv8Factory::setManualTime(Uuidv8Factory::now());
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Borrow);
+    RawUuid id;
+    for (auto _ : state) {
+        Uuidv8Factory::createBatch(1, &id);
+        benchmark::DoNotOptimize(id);
+    }
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Wait);
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_Create, shared, Uuidv8Factory::Mode::Shared)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Create, thread_local, Uuidv8Factory::Mode::ThreadLocal)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_CreateBatch, shared, Uuidv8Factory::Mode::Shared)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_CreateBatch, thread_local, Uuidv8Factory::Mode::ThreadLocal)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Now, realtime, Uuidv8Factory::Clock::Realtime);
+BENCHMARK_CAPTURE(BM_Now, realtime_coarse, Uuidv8Factory::Clock::RealtimeCoarse);
+BENCHMARK_CAPTURE(BM_Now, cached, Uuidv8Factory::Clock::Cached);
+BENCHMARK_CAPTURE(BM_Now, manual, Uuidv8Factory::Clock::Manual);
+BENCHMARK_CAPTURE(BM_CreateWithClock, realtime, Uuidv8Factory::Clock::Realtime);
+BENCHMARK_CAPTURE(BM_CreateWithClock, realtime_coarse, Uuidv8Factory::Clock::RealtimeCoarse);
+BENCHMARK_CAPTURE(BM_CreateWithClock, cached, Uuidv8Factory::Clock::Cached);
+BENCHMARK_CAPTURE(BM_CreateWithClock, manual, Uuidv8Factory::Clock::Manual);
@@ -17,12 +17,13 @@ class UpCpp(ConanFile):
     conan_version = None
     generators = "CMakeDeps", "PkgConfigDeps", "VirtualRunEnv", "VirtualBuildEnv"
     version = "0.1"
-    exports_sources = "CMakeLists.txt", "conaninfo/*", "include/*" ,"src/*" , "test/*"
+    exports_sources = "CMakeLists.txt", "conaninfo/*", "include/*" ,"src/*" , "test/*", "benchmark/*"
 
     options = {
         "shared": [True, False],
         "fPIC": [True, False],
         "build_testing": [True, False],
+        "build_benchmarks": [True, False],
         "build_unbundled": [True, False],
         "build_cross_compiling": [True, False],
     }
@@ -31,6 +32,7 @@ class UpCpp(ConanFile):
         "shared": False,
         "fPIC": False,
         "build_testing": False,
+        "build_benchmarks": False,
         "build_unbundled": False,
         "build_cross_compiling": False,
     }
@@ -48,6 +50,8 @@ class UpCpp(ConanFile):
         self.requires("spdlog/1.13.0")
         if self.options.build_testing:
             self.requires("gtest/1.14.0")
+        if self.options.build_benchmarks:
+            self.requires("benchmark/1.8.3")
         if self.options.build_unbundled:
             self.requires("up-core-api/{}".format(self.up_core_api_version))
         
@@ -55,6 +59,7 @@ class UpCpp(ConanFile):
     def generate(self):
         tc = CMakeToolchain(self)
         tc.variables["BUILD_TESTING"] = self.options.build_testing
+        tc.variables["BUILD_BENCHMARKS"] = self.options.build_benchmarks
         tc.variables["BUILD_UNBUNDLED"] = self.options.build_unbundled
         tc.variables["BUILD_SHARED_LIBS"] = self.options.shared
         tc.generate()
@@ -37,6 +37,7 @@
 #include <string_view>
 #include <arpa/inet.h>
 #include <spdlog/spdlog.h>
+#include "../serializer/IpAddress.h"
 #include "../tools/Utils.h"
 #include "up-core-api/uri.pb.h"
 
@@ -107,29 +108,15 @@ namespace uprotocol::uri {
                 spdlog::error("UAutority already has ip set {}. Ignoring setIp()", authority_.ip());
                 return *this;
             }
-            std::string m_address = isBlank(address) ? "" : address;
-            
-            char ip_char[INET6_ADDRSTRLEN + 1];
-            memset(ip_char, 0, INET6_ADDRSTRLEN + 1);
-            if (in6_addr ipv6{}; inet_pton(AF_INET6, m_address.c_str(), &ipv6) == 1) {
-                if (inet_ntop(AF_INET6,
-                              &ipv6,
-                              ip_char,
-                              INET6_ADDRSTRLEN) != nullptr) {
-                    authority_.set_ip(ip_char);
-                }
-            } else if (struct in_addr ipv4{}; inet_pton(AF_INET, m_address.c_str(), &ipv4) == 1) {
-                if (inet_ntop(AF_INET,
-                              &ipv4, 
-                              ip_char, 
-                              INET_ADDRSTRLEN) != nullptr) {
-                    authority_.set_ip(ip_char);
-                } else {
-                    spdlog::error<std::string_view>("UAutority address is not a valid IPV4 address. Ignoring setIp()");
-                    return *this;
-                }
-            } else {
-                spdlog::error<std::string_view>("UAutority address is not a valid IP address. Ignoring setIp()");
+            std::string normalized;
+            switch (IpAddress::normalize(isBlank(address) ? std::string_view() : address, normalized)) {
+                case IpAddress::AddressType::IpV4:
+                case IpAddress::AddressType::IpV6:
+                    authority_.set_ip(std::move(normalized));
+                    break;
+                default:
+                    spdlog::error<std::string_view>("UAutority address is not a valid IP address. Ignoring setIp()");
+                    break;
             }
             return *this;
         }
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_CACHE_H_
+#define URI_CACHE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <up-core-api/uri.pb.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Opt-in cache of long format URIs that were already deserialized.
+ * Maps the URI string to an immutable, shared UUri and its validity, so
+ * services that see the same topics over and over parse each of them once.
+ * The cache is split in shards selected by the hash of the URI, each shard
+ * has its own lock and bounds its number of entries with the CLOCK
+ * (second chance) policy: a hit only sets the referenced bit of the entry
+ * under a shared lock, so readers of the same hot URI do not serialize.
+ */
+class UriCache {
+public:
+    /**
+     * A deserialized URI.
+     */
+    struct Entry {
+        /**
+         * The URI as returned by LongUriSerializer::deserialize, or an empty
+         * UUri if the URI is invalid.
+         */
+        const v1::UUri uri;
+        /**
+         * Same as valid_uri() on the URI string.
+         */
+        const bool valid;
+    };
+
+    /**
+     * Default maximum number of cached URIs.
+     */
+    static constexpr std::size_t DefaultCapacity = 4096;
+    /**
+     * Default number of shards.
+     */
+    static constexpr std::size_t DefaultShards = 16;
+
+    /**
+     * Constructor.
+     * @param capacity Maximum number of cached URIs, spread evenly over the
+     * shards. At least one URI is always cached.
+     * @param shards Number of shards, at least one and at most capacity.
+     */
+    explicit UriCache(std::size_t capacity = DefaultCapacity, std::size_t shards = DefaultShards);
+
+    UriCache(const UriCache&) = delete;
+    UriCache& operator=(const UriCache&) = delete;
+
+    /**
+     * Get the deserialized URI, parsing and caching it if it is not cached yet.
+     * @param uri A long format uProtocol URI.
+     * @return Returns the cached entry, never nullptr.
+     */
+    [[nodiscard]] auto get(std::string_view uri) -> std::shared_ptr<const Entry>;
+
+    /**
+     * Cached equivalent of LongUriSerializer::deserialize, except that it
+     * returns an empty UUri instead of throwing for an invalid URI.
+     * @param uri A long format uProtocol URI.
+     * @return Returns the shared UUri, never nullptr.
+     */
+    [[nodiscard]] auto deserialize(std::string_view uri) -> std::shared_ptr<const v1::UUri>;
+
+    /**
+     * Cached equivalent of valid_uri.
+     * @param uri A long format uProtocol URI.
+     * @return true if the URI is valid.
+     */
+    [[nodiscard]] auto isValid(std::string_view uri) -> bool { return get(uri)->valid; }
+
+    /**
+     * Number of lookups that found the URI in the cache.
+     */
+    [[nodiscard]] auto hits() const -> uint64_t;
+
+    /**
+     * Number of lookups that had to deserialize the URI.
+     */
+    [[nodiscard]] auto misses() const -> uint64_t;
+
+    /**
+     * Number of cached URIs.
+     */
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    /**
+     * Maximum number of cached URIs.
+     */
+    [[nodiscard]] auto capacity() const -> std::size_t { return capacity_; }
+
+    /**
+     * Number of shards.
+     */
+    [[nodiscard]] auto shards() const -> std::size_t { return shards_.size(); }
+
+    /**
+     * Remove all the cached URIs and reset the counters.
+     * Entries already handed out stay valid.
+     */
+    auto clear() -> void;
+
+private:
+    /**
+     * One independently locked part of the cache, on its own cache lines.
+     * Lookups take the lock shared, insertions and evictions exclusive.
+     */
+    struct alignas(64) Shard {
+        /**
+         * Cached URI string and its entry.
+         */
+        struct Node {
+            Node(std::string_view uri, std::shared_ptr<const Entry> e) : key(uri), entry(std::move(e)) {}
+            std::string key;
+            std::shared_ptr<const Entry> entry;
+            /**
+             * Set by a hit, cleared when the clock hand passes over the node.
+             */
+            std::atomic<bool> referenced{false};
+        };
+        mutable std::shared_mutex mutex;
+        /**
+         * Maximum number of nodes.
+         */
+        std::size_t capacity = 1;
+        /**
+         * Nodes in insertion order, reused in place on eviction.
+         */
+        std::deque<Node> nodes;
+        /**
+         * Index of the nodes. The keys are views of Node::key.
+         */
+        std::unordered_map<std::string_view, std::size_t> index;
+        /**
+         * Next node considered for eviction.
+         */
+        std::size_t hand = 0;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+    };
+
+    /**
+     * Select the node to evict from a full shard, giving a second chance to
+     * the referenced ones. Called with the shard locked exclusively.
+     * @param shard The shard.
+     * @return the index of the node.
+     */
+    static auto evict(Shard& shard) -> std::size_t;
+
+    /**
+     * Select the shard of a URI.
+     * @param uri A long format uProtocol URI.
+     * @return the shard.
+     */
+    auto shardOf(std::string_view uri) -> Shard&;
+
+    /**
+     * Maximum number of cached URIs, the sum of the capacities of the shards.
+     */
+    std::size_t capacity_;
+    /**
+     * The shards.
+     */
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+}; // class UriCache
+
+} // namespace uprotocol::uri
+
+#endif // URI_CACHE_H_
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MICRO_URI_H_
+#define MICRO_URI_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <up-cpp/uri/serializer/IpAddress.h>
+
+namespace uprotocol::uri {
+
+/**
+ * A micro format URI, without the protobuf UUri and its heap allocated parts.
+ * Trivially copyable: the local part and an IP address are held inline, an
+ * id authority is a view of the id bytes of the buffer or UUri it was read
+ * from, which must outlive it.
+ *
+ * Local URIs are identified by key(), a single integer that dispatch tables
+ * can use directly.
+ */
+struct MicroUri {
+    using AddressType = IpAddress::AddressType;
+
+    /** Micro URI format version */
+    static constexpr uint8_t UpVersion = 0x01;
+    /** Length of a local micro URI */
+    static constexpr std::size_t LocalLength = 8;
+    /** Length of the longest micro URI, with a 255 bytes id */
+    static constexpr std::size_t MaxLength = LocalLength + 1 + 255;
+
+    uint16_t resourceId = 0;
+    uint16_t entityId = 0;
+    uint8_t entityVersion = 0;
+    /** Local, IpV4, IpV6 or Id */
+    AddressType addressType = AddressType::Local;
+    /** Number of bytes of the IP address or of the id */
+    uint8_t addressLength = 0;
+    std::array<uint8_t, IpAddress::IpV6AddressBytes> ip{};
+    /** The id bytes of an Id authority, not owned */
+    const uint8_t* id = nullptr;
+
+    /**
+     * @return a local micro URI
+     */
+    static constexpr auto local(uint16_t entity_id, uint8_t entity_version, uint16_t resource_id) noexcept
+        -> MicroUri {
+        MicroUri uri;
+        uri.entityId = entity_id;
+        uri.entityVersion = entity_version;
+        uri.resourceId = resource_id;
+        return uri;
+    }
+
+    /**
+     * The 40 bit key of the local part: entity id, entity version, resource id.
+     */
+    static constexpr auto makeKey(uint16_t entity_id, uint8_t entity_version, uint16_t resource_id) noexcept
+        -> uint64_t {
+        return (static_cast<uint64_t>(entity_id) << 24) | (static_cast<uint64_t>(entity_version) << 16) | resource_id;
+    }
+
+    [[nodiscard]] constexpr auto key() const noexcept -> uint64_t {
+        return makeKey(entityId, entityVersion, resourceId);
+    }
+
+    [[nodiscard]] constexpr auto isLocal() const noexcept -> bool { return AddressType::Local == addressType; }
+
+    /**
+     * The address bytes: the IP address, the id, or nothing for a local URI.
+     */
+    [[nodiscard]] auto address() const noexcept -> std::string_view {
+        const auto* bytes = AddressType::Id == addressType ? id : ip.data();
+        return {reinterpret_cast<const char*>(bytes), addressLength};
+    }
+
+    /**
+     * @return the number of bytes of the micro format
+     */
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+        return LocalLength + (AddressType::Id == addressType ? 1 : 0) + addressLength;
+    }
+
+    /**
+     * Read a micro format URI. Both Local and Invalid, which MicroUriSerializer
+     * writes, are accepted as the address type of a local URI.
+     * @param bytes The micro format, viewed by uri.id for an id authority.
+     * @param size Number of bytes, exactly the length of the URI.
+     * @param[out] uri The URI read.
+     * @return false if the bytes are not a micro URI.
+     */
+    static auto parse(const uint8_t* bytes, std::size_t size, MicroUri& uri) noexcept -> bool {
+        if (size < LocalLength || UpVersion != bytes[0]) {
+            return false;
+        }
+        uri.resourceId = static_cast<uint16_t>((bytes[2] << 8) | bytes[3]);
+        uri.entityId = static_cast<uint16_t>((bytes[4] << 8) | bytes[5]);
+        uri.entityVersion = bytes[6];
+        uri.id = nullptr;
+        switch (static_cast<AddressType>(bytes[1])) {
+            case AddressType::Local:
+            case AddressType::Invalid:
+                uri.addressType = AddressType::Local;
+                uri.addressLength = 0;
+                return LocalLength == size;
+            case AddressType::IpV4:
+                uri.addressType = AddressType::IpV4;
+                uri.addressLength = IpAddress::IpV4AddressBytes;
+                break;
+            case AddressType::IpV6:
+                uri.addressType = AddressType::IpV6;
+                uri.addressLength = IpAddress::IpV6AddressBytes;
+                break;
+            case AddressType::Id:
+                if (size <= LocalLength + 1 || LocalLength + 1 + bytes[LocalLength] != size) {
+                    return false;
+                }
+                uri.addressType = AddressType::Id;
+                uri.addressLength = bytes[LocalLength];
+                uri.id = bytes + LocalLength + 1;
+                return true;
+            default:
+                return false;
+        }
+        if (LocalLength + uri.addressLength != size) {
+            return false;
+        }
+        std::memcpy(uri.ip.data(), bytes + LocalLength, uri.addressLength);
+        return true;
+    }
+
+    /**
+     * Read the key of a local micro URI, and nothing else.
+     * @param bytes The micro format.
+     * @param size Number of bytes, exactly the length of the URI.
+     * @param[out] key The key of the URI read.
+     * @return false if the bytes are not a local micro URI.
+     */
+    static constexpr auto parseKey(const uint8_t* bytes, std::size_t size, uint64_t& key) noexcept -> bool {
+        if (LocalLength != size || UpVersion != bytes[0] ||
+            (static_cast<uint8_t>(AddressType::Local) != bytes[1] &&
+             static_cast<uint8_t>(AddressType::Invalid) != bytes[1])) {
+            return false;
+        }
+        key = makeKey(static_cast<uint16_t>((bytes[4] << 8) | bytes[5]), bytes[6],
+                      static_cast<uint16_t>((bytes[2] << 8) | bytes[3]));
+        return true;
+    }
+
+    /**
+     * Write the micro format, the bytes MicroUriSerializer::serialize gives.
+     * @param[out] bytes Buffer, MaxLength bytes are always enough.
+     * @param capacity Number of bytes of the buffer.
+     * @return the number of bytes written, 0 if the buffer is too small.
+     */
+    auto serialize(uint8_t* bytes, std::size_t capacity) const noexcept -> std::size_t {
+        const auto length = size();
+        if (length > capacity) {
+            return 0;
+        }
+        bytes[0] = UpVersion;
+        // MicroUriSerializer marks local URIs with Invalid
+        bytes[1] = static_cast<uint8_t>(isLocal() ? AddressType::Invalid : addressType);
+        bytes[2] = static_cast<uint8_t>(resourceId >> 8);
+        bytes[3] = static_cast<uint8_t>(resourceId & 0xFF);
+        bytes[4] = static_cast<uint8_t>(entityId >> 8);
+        bytes[5] = static_cast<uint8_t>(entityId & 0xFF);
+        bytes[6] = entityVersion;
+        bytes[7] = 0;
+        auto* tail = bytes + LocalLength;
+        if (AddressType::Id == addressType) {
+            *tail++ = addressLength;
+        }
+        if (0 != addressLength) {
+            std::memcpy(tail, address().data(), addressLength);
+        }
+        return length;
+    }
+};
+
+/**
+ * Equal when the local parts, the address types and the address bytes are.
+ */
+inline bool operator==(const MicroUri &s, const MicroUri &o) noexcept {
+    return s.key() == o.key() && s.addressType == o.addressType && s.address() == o.address();
+}
+
+inline bool operator!=(const MicroUri &s, const MicroUri &o) noexcept {
+    return !(s == o);
+}
+
+/**
+ * Order by local part, then address type, then address bytes.
+ */
+inline bool operator<(const MicroUri &s, const MicroUri &o) noexcept {
+    if (s.key() != o.key()) {
+        return s.key() < o.key();
+    }
+    if (s.addressType != o.addressType) {
+        return s.addressType < o.addressType;
+    }
+    return s.address() < o.address();
+}
+
+/**
+ * Hash of a micro URI. The key of a local URI only uses its low 40 bits, so
+ * it is mixed into every bit of the result.
+ */
+inline std::size_t hashMicroUri(const MicroUri &uri) noexcept {
+    uint64_t h = uri.key();
+    if (!uri.isLocal()) {
+        h ^= static_cast<uint64_t>(std::hash<std::string_view>{}(uri.address())) +
+             (static_cast<uint64_t>(uri.addressType) << 40);
+    }
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(h ^ (h >> 31));
+}
+
+} // namespace uprotocol::uri
+
+namespace std {
+
+template<>
+struct hash<uprotocol::uri::MicroUri> {
+    std::size_t operator()(const uprotocol::uri::MicroUri &uri) const noexcept {
+        return uprotocol::uri::hashMicroUri(uri);
+    }
+};
+
+} // namespace std
+
+#endif // MICRO_URI_H_
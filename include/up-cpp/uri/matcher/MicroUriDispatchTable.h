@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MICRO_URI_DISPATCH_TABLE_H_
+#define MICRO_URI_DISPATCH_TABLE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <up-cpp/uri/datamodel/MicroUri.h>
+#include <up-cpp/uri/matcher/RcuPointer.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Listeners of local micro URIs, found by the 40 bit MicroUri::key() of the
+ * URI. The receive path goes from the micro format bytes to the listeners
+ * with a key read and a probe, without building a UUri.
+ *
+ * Keys are held in an open addressed table, at most half full, probed
+ * linearly from a multiplicative hash. The table is immutable: every update
+ * builds a new one and publishes it through an RcuPointer, so lookups and
+ * updates never wait for each other. A replaced table is freed by a later
+ * update once no lookup can use it. Updates are serialized and cost a copy
+ * of the table; they are meant to be rare compared to lookups.
+ *
+ * @tparam Listener Copyable, equality comparable listener type.
+ */
+template <typename Listener>
+class MicroUriDispatchTable {
+public:
+    using Listeners = std::vector<Listener>;
+
+    /**
+     * Largest key, MicroUri::key() being 40 bits wide.
+     */
+    static constexpr uint64_t MaxKey = MicroUri::makeKey(UINT16_MAX, UINT8_MAX, UINT16_MAX);
+
+    MicroUriDispatchTable() = default;
+
+    MicroUriDispatchTable(const MicroUriDispatchTable&) = delete;
+    MicroUriDispatchTable& operator=(const MicroUriDispatchTable&) = delete;
+
+    ~MicroUriDispatchTable() = default;
+
+    /**
+     * Register a listener for a key.
+     * @param key MicroUri::key() of a local URI.
+     * @param listener Listener reported for the URI.
+     * @return false if the key is above MaxKey, and nothing is registered.
+     */
+    auto add(uint64_t key, Listener listener) -> bool {
+        if (key > MaxKey) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const auto* current = table_.writerGet();
+        std::shared_ptr<const Listeners> listeners = current ? current->find(key) : nullptr;
+        auto updated = listeners ? std::make_shared<Listeners>(*listeners) : std::make_shared<Listeners>();
+        updated->push_back(std::move(listener));
+        publish(rebuild(current, key, std::move(updated)));
+        return true;
+    }
+
+    /**
+     * Register a listener for a local micro URI.
+     * @return false if the URI is not local, and nothing is registered.
+     */
+    auto add(const MicroUri& uri, Listener listener) -> bool {
+        if (!uri.isLocal()) {
+            return false;
+        }
+        return add(uri.key(), std::move(listener));
+    }
+
+    /**
+     * Unregister a listener from a key.
+     * @return false if the listener was not registered for the key, or the
+     * key is above MaxKey.
+     */
+    auto remove(uint64_t key, const Listener& listener) -> bool {
+        if (key > MaxKey) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const auto* current = table_.writerGet();
+        auto listeners = current ? current->find(key) : nullptr;
+        if (!listeners) {
+            return false;
+        }
+        auto it = std::find(listeners->begin(), listeners->end(), listener);
+        if (it == listeners->end()) {
+            return false;
+        }
+        std::shared_ptr<Listeners> updated;
+        if (listeners->size() > 1) {
+            updated = std::make_shared<Listeners>(*listeners);
+            updated->erase(updated->begin() + (it - listeners->begin()));
+        }
+        publish(rebuild(current, key, std::move(updated)));
+        return true;
+    }
+
+    /**
+     * Unregister a listener from a local micro URI.
+     * @return false if the URI is not local or the listener was not registered for it.
+     */
+    auto remove(const MicroUri& uri, const Listener& listener) -> bool {
+        return uri.isLocal() && remove(uri.key(), listener);
+    }
+
+    /**
+     * Get the listeners of a key. Lock free. The list is immutable and
+     * stays valid while it is held, whatever the updates that follow.
+     * @param key MicroUri::key() of a local URI.
+     * @return nullptr if no listener is registered for the key.
+     */
+    [[nodiscard]] auto find(uint64_t key) const -> std::shared_ptr<const Listeners> {
+        const auto guard = table_.read();
+        const auto* table = guard.get();
+        return table ? table->find(key) : nullptr;
+    }
+
+    /**
+     * Get the listeners of a local micro URI given in micro format.
+     * @return nullptr if the bytes are not a local micro URI, or if no
+     * listener is registered for it.
+     */
+    [[nodiscard]] auto find(const uint8_t* bytes, std::size_t size) const -> std::shared_ptr<const Listeners> {
+        uint64_t key = 0;
+        return MicroUri::parseKey(bytes, size, key) ? find(key) : nullptr;
+    }
+
+    /**
+     * Call a function for each listener of a local micro URI given in micro
+     * format. The listeners are read in place, with no reference count
+     * taken. The function may update this table, the update applies to later
+     * lookups, and the tables it replaces are kept until it returns.
+     * Nothing is allocated.
+     * @param callback Called with each const Listener&.
+     * @return the number of listeners called.
+     */
+    template <typename Callback>
+    auto dispatch(const uint8_t* bytes, std::size_t size, Callback&& callback) const -> std::size_t {
+        uint64_t key = 0;
+        if (!MicroUri::parseKey(bytes, size, key)) {
+            return 0;
+        }
+        const auto guard = table_.read();
+        const auto* table = guard.get();
+        if (!table) {
+            return 0;
+        }
+        const auto slot = table->slotOf(key);
+        if (key != table->keys[slot]) {
+            return 0;
+        }
+        const auto& listeners = *table->listeners[slot];
+        for (const auto& listener : listeners) {
+            callback(listener);
+        }
+        return listeners.size();
+    }
+
+    /**
+     * Number of keys with at least one listener.
+     */
+    [[nodiscard]] auto size() const -> std::size_t {
+        const auto guard = table_.read();
+        const auto* table = guard.get();
+        return table ? table->count : 0;
+    }
+
+private:
+    static constexpr uint64_t EmptyKey = ~uint64_t{0};
+    static constexpr std::size_t MinCapacityBits = 3;
+
+    /**
+     * Immutable open addressed table. Keys are apart from the listeners so
+     * that a probe reads consecutive keys only.
+     */
+    struct Table {
+        explicit Table(std::size_t capacity_bits)
+            : keys(std::size_t{1} << capacity_bits, EmptyKey),
+              listeners(std::size_t{1} << capacity_bits),
+              shift(64 - capacity_bits) {}
+
+        [[nodiscard]] auto slotOf(uint64_t key) const -> std::size_t {
+            const auto mask = keys.size() - 1;
+            auto slot = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift);
+            while (key != keys[slot] && EmptyKey != keys[slot]) {
+                slot = (slot + 1) & mask;
+            }
+            return slot;
+        }
+
+        [[nodiscard]] auto find(uint64_t key) const -> std::shared_ptr<const Listeners> {
+            const auto slot = slotOf(key);
+            return key == keys[slot] ? listeners[slot] : nullptr;
+        }
+
+        auto insert(uint64_t key, std::shared_ptr<const Listeners> list) -> void {
+            const auto slot = slotOf(key);
+            keys[slot] = key;
+            listeners[slot] = std::move(list);
+            ++count;
+        }
+
+        std::vector<uint64_t> keys;
+        std::vector<std::shared_ptr<const Listeners>> listeners;
+        unsigned shift;
+        std::size_t count = 0;
+    };
+
+    /**
+     * Copy of a table with the listeners of a key replaced, or removed when nullptr.
+     * @return nullptr if the copy would be empty.
+     */
+    static auto rebuild(const Table* table, uint64_t key, std::shared_ptr<const Listeners> listeners)
+        -> std::unique_ptr<Table> {
+        std::size_t count = listeners ? 1 : 0;
+        if (table) {
+            count += table->count - (table->find(key) ? 1 : 0);
+        }
+        if (0 == count) {
+            return nullptr;
+        }
+        auto bits = MinCapacityBits;
+        while ((std::size_t{1} << bits) < 2 * count) {
+            ++bits;
+        }
+        auto copy = std::make_unique<Table>(bits);
+        if (table) {
+            for (std::size_t slot = 0; slot < table->keys.size(); ++slot) {
+                if (EmptyKey != table->keys[slot] && key != table->keys[slot]) {
+                    copy->insert(table->keys[slot], table->listeners[slot]);
+                }
+            }
+        }
+        if (listeners) {
+            copy->insert(key, std::move(listeners));
+        }
+        return copy;
+    }
+
+    /**
+     * Replace the table. Called with writeMutex_ held.
+     */
+    auto publish(std::unique_ptr<Table> table) -> void { table_.publish(std::move(table)); }
+
+    /**
+     * Current table, nullptr when empty.
+     */
+    RcuPointer<Table> table_;
+    /**
+     * Serializes the updates.
+     */
+    std::mutex writeMutex_;
+
+}; // class MicroUriDispatchTable
+
+} // namespace uprotocol::uri
+
+#endif // MICRO_URI_DISPATCH_TABLE_H_
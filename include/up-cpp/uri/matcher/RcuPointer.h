@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef RCU_POINTER_H_
+#define RCU_POINTER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace uprotocol::uri {
+
+/**
+ * Owning pointer to an immutable value that readers use without locks while
+ * writers replace it, in the read-copy-update style.
+ *
+ * A reader announces itself on a reader counter, loads the pointer and uses
+ * the value until it leaves the counter. Counters are striped over cache
+ * lines by thread so that readers on different cores do not share one, and
+ * there are two sets of them, selected by an epoch that each update flips.
+ * A replaced value is kept until every counter has been seen empty since the
+ * replacement: new readers go to the other set, so a busy set drains.
+ *
+ * Writers never wait for readers, so a reader may replace the value it is
+ * reading. A replaced value is freed by a later publish() once no reader can
+ * hold it, or when the pointer is destroyed.
+ *
+ * Readers take one read-modify-write on their counter to enter, and one to
+ * leave. Writers must be serialized by the owner.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class RcuPointer {
+public:
+    /**
+     * Keeps the current value alive while it is held. Lock free.
+     */
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const RcuPointer& owner)
+            : count_(owner.enter()),
+              // seq_cst, with the increment in enter(): a writer that
+              // exchanged the value before it reads this counter as empty
+              // is seen by this load.
+              value_(owner.current_.load(std::memory_order_seq_cst)) {}
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ~ReadGuard() { count_.fetch_sub(1, std::memory_order_release); }
+
+        /**
+         * @return the value read, nullptr when none is set.
+         */
+        [[nodiscard]] auto get() const -> const T* { return value_; }
+
+    private:
+        std::atomic<std::size_t>& count_;
+        const T* value_;
+    };
+
+    RcuPointer() = default;
+
+    RcuPointer(const RcuPointer&) = delete;
+    RcuPointer& operator=(const RcuPointer&) = delete;
+
+    /**
+     * Frees the current and replaced values. No reader may be left.
+     */
+    ~RcuPointer() { delete current_.load(std::memory_order_relaxed); }
+
+    /**
+     * Read the current value.
+     */
+    [[nodiscard]] auto read() const -> ReadGuard { return ReadGuard(*this); }
+
+    /**
+     * Current value, for a writer.
+     */
+    [[nodiscard]] auto writerGet() const -> const T* { return current_.load(std::memory_order_relaxed); }
+
+    /**
+     * Replace the value. The previous one stays valid for the readers that
+     * hold it, and is freed once none can.
+     * @param value New value, nullptr to clear.
+     */
+    auto publish(std::unique_ptr<const T> value) -> void {
+        std::unique_ptr<const T> previous(current_.exchange(value.release(), std::memory_order_seq_cst));
+        if (previous) {
+            retired_.push_back(Retired{std::move(previous), 0});
+        }
+        reclaim();
+    }
+
+    /**
+     * Number of replaced values not freed yet.
+     */
+    [[nodiscard]] auto retiredCount() const -> std::size_t { return retired_.size(); }
+
+private:
+    static constexpr std::size_t Stripes = 8;
+    static constexpr uint32_t AllDrained = (uint32_t{1} << (2 * Stripes)) - 1;
+
+    /**
+     * Reader counter, on its own cache line.
+     */
+    struct alignas(64) Readers {
+        std::atomic<std::size_t> count{0};
+    };
+
+    struct Retired {
+        std::unique_ptr<const T> value;
+        /**
+         * Counters seen empty since the value was replaced, one bit each.
+         */
+        uint32_t drained;
+    };
+
+    static auto stripe() -> std::size_t {
+        static std::atomic<std::size_t> next{0};
+        static thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % Stripes;
+        return index;
+    }
+
+    auto enter() const -> std::atomic<std::size_t>& {
+        // The epoch only spreads the readers, any value of it is safe.
+        auto& count = readers_[epoch_.load(std::memory_order_relaxed) & 1][stripe()].count;
+        count.fetch_add(1, std::memory_order_seq_cst);
+        return count;
+    }
+
+    /**
+     * Free the replaced values no reader can hold. A reader holding one
+     * entered its counter before the value was replaced, so the value is
+     * free once each counter has been seen empty after that.
+     */
+    auto reclaim() -> void {
+        if (retired_.empty()) {
+            return;
+        }
+        epoch_.fetch_add(1, std::memory_order_relaxed);
+        uint32_t drained = 0;
+        for (std::size_t set = 0; set < 2; ++set) {
+            for (std::size_t i = 0; i < Stripes; ++i) {
+                if (0 == readers_[set][i].count.load(std::memory_order_seq_cst)) {
+                    drained |= uint32_t{1} << (set * Stripes + i);
+                }
+            }
+        }
+        for (auto& retired : retired_) {
+            retired.drained |= drained;
+        }
+        retired_.erase(std::remove_if(retired_.begin(), retired_.end(),
+                                      [](const Retired& retired) { return AllDrained == retired.drained; }),
+                       retired_.end());
+    }
+
+    /**
+     * Current value, nullptr when none. Owned.
+     */
+    std::atomic<const T*> current_{nullptr};
+    /**
+     * Selects the set of counters new readers enter.
+     */
+    std::atomic<std::size_t> epoch_{0};
+    mutable Readers readers_[2][Stripes];
+    /**
+     * Replaced values still possibly held by readers. Writer only.
+     */
+    std::vector<Retired> retired_;
+
+}; // class RcuPointer
+
+} // namespace uprotocol::uri
+
+#endif // RCU_POINTER_H_
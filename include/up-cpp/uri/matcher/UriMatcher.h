@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_MATCHER_H_
+#define URI_MATCHER_H_
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <up-cpp/uri/matcher/RcuPointer.h>
+#include <up-cpp/uri/tools/Utils.h>
+#include <up-core-api/uri.pb.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Matches URIs against registered patterns, for listener dispatch.
+ *
+ * A pattern is a UUri in which a segment that is not set, or set to "*",
+ * matches any value. The segments are, in order: authority, entity name,
+ * entity major version, resource name, resource instance and resource
+ * message. An empty authority is the local authority, use "*" as the
+ * authority name to match any. So "//vcu.my_car_vin" covers a whole
+ * authority, and "/body.access" every version and resource of a local entity.
+ *
+ * Patterns are kept in a trie with one level per segment. A pattern ends
+ * at its last set segment, so the wildcards that follow it cost nothing.
+ * Matching visits at most two children per level, the exact one and the
+ * wildcard one, whatever the number of patterns.
+ *
+ * The trie is immutable. Updates copy the path they change and publish
+ * the new root through an RcuPointer: matching takes no lock and no
+ * reference count, and keeps using the version it started with while a
+ * writer replaces it. Writers do not wait for readers either, a replaced
+ * root is freed by a later update once no match can use it. Updates are
+ * serialized.
+ *
+ * @tparam Subscriber Copyable, equality comparable subscriber type.
+ */
+template <typename Subscriber>
+class UriMatcher {
+public:
+    /**
+     * Segment value matching anything.
+     */
+    static constexpr std::string_view Wildcard = "*";
+
+    UriMatcher() = default;
+
+    UriMatcher(const UriMatcher&) = delete;
+    UriMatcher& operator=(const UriMatcher&) = delete;
+
+    /**
+     * Register a subscriber for a pattern.
+     * @param pattern URI pattern.
+     * @param subscriber Subscriber reported for every URI matching the pattern.
+     */
+    auto add(const v1::UUri& pattern, Subscriber subscriber) -> void {
+        const Segments segments(pattern, true);
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        publish(with(root_.writerGet(), segments, 0, std::move(subscriber)));
+    }
+
+    /**
+     * Unregister a subscriber from a pattern.
+     * @param pattern URI pattern it was registered with.
+     * @param subscriber Subscriber to remove.
+     * @return false if the subscriber was not registered for the pattern.
+     */
+    auto remove(const v1::UUri& pattern, const Subscriber& subscriber) -> bool {
+        const Segments segments(pattern, true);
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const auto* root = root_.writerGet();
+        if (!root) {
+            return false;
+        }
+        bool removed = false;
+        auto updated = without(*root, segments, 0, subscriber, removed);
+        if (removed) {
+            publish(std::move(updated));
+        }
+        return removed;
+    }
+
+    /**
+     * Call a function for each subscriber whose pattern matches a URI. A
+     * subscriber registered with several matching patterns is reported once
+     * for each. Nothing is allocated. The function may update this matcher,
+     * the update applies to later matches.
+     * @param uri URI of an incoming message.
+     * @param callback Called with each matching const Subscriber&.
+     */
+    template <typename Callback>
+    auto forEachMatch(const v1::UUri& uri, Callback&& callback) const -> void {
+        const Segments segments(uri, false);
+        const auto guard = root_.read();
+        if (const auto* root = guard.get()) {
+            visit(*root, segments, 0, callback);
+        }
+    }
+
+    /**
+     * Get the subscribers whose pattern matches a URI.
+     * @param uri URI of an incoming message.
+     * @return Returns the matching subscribers, once per matching pattern.
+     */
+    [[nodiscard]] auto match(const v1::UUri& uri) const -> std::vector<Subscriber> {
+        std::vector<Subscriber> matches;
+        forEachMatch(uri, [&matches](const Subscriber& subscriber) { matches.push_back(subscriber); });
+        return matches;
+    }
+
+    /**
+     * Number of registered (pattern, subscriber) pairs.
+     */
+    [[nodiscard]] auto size() const -> std::size_t {
+        const auto guard = root_.read();
+        const auto* root = guard.get();
+        return root ? root->count : 0;
+    }
+
+private:
+    static constexpr std::size_t Levels = 6;
+
+    /**
+     * Segments of a URI or of a pattern, as trie keys. Views into the URI,
+     * except for the version, formatted into the object itself.
+     */
+    class Segments {
+    public:
+        Segments(const v1::UUri& uri, bool is_pattern) {
+            const auto& authority = uri.authority();
+            if (isEmpty(authority)) {
+                keys_[0] = std::string_view();
+            } else if (!authority.name().empty()) {
+                keys_[0] = authority.name();
+            } else if (!authority.ip().empty()) {
+                keys_[0] = authority.ip();
+            } else {
+                keys_[0] = authority.id();
+            }
+            keys_[1] = uri.entity().name();
+            if (uri.entity().has_version_major()) {
+                auto result = std::to_chars(version_.data(), version_.data() + version_.size(),
+                                            uri.entity().version_major());
+                keys_[2] = std::string_view(version_.data(), static_cast<std::size_t>(result.ptr - version_.data()));
+            }
+            keys_[3] = uri.resource().name();
+            keys_[4] = uri.resource().instance();
+            keys_[5] = uri.resource().message();
+
+            if (is_pattern) {
+                wildcards_[0] = Wildcard == keys_[0];
+                wildcards_[2] = !uri.entity().has_version_major();
+                for (auto level : {1, 3, 4, 5}) {
+                    wildcards_[level] = keys_[level].empty() || Wildcard == keys_[level];
+                }
+                depth_ = Levels;
+                while (depth_ > 0 && wildcards_[depth_ - 1]) {
+                    --depth_;
+                }
+            }
+        }
+
+        Segments(const Segments&) = delete;
+        Segments& operator=(const Segments&) = delete;
+
+        [[nodiscard]] auto key(std::size_t level) const -> std::string_view { return keys_[level]; }
+
+        [[nodiscard]] auto isWildcard(std::size_t level) const -> bool { return wildcards_[level]; }
+
+        /**
+         * Number of segments up to the last one set in a pattern.
+         */
+        [[nodiscard]] auto depth() const -> std::size_t { return depth_; }
+
+    private:
+        std::array<std::string_view, Levels> keys_{};
+        std::array<bool, Levels> wildcards_{};
+        std::array<char, 10> version_{};
+        std::size_t depth_ = Levels;
+    };
+
+    /**
+     * Immutable trie node.
+     */
+    struct Node {
+        /**
+         * Segment value leading to this node, owns the keys of the parent's children.
+         */
+        std::string key;
+        /**
+         * Subscribers of the patterns ending at this node.
+         */
+        std::vector<Subscriber> subscribers;
+        std::unordered_map<std::string_view, std::shared_ptr<const Node>> children;
+        std::shared_ptr<const Node> wildcard;
+        /**
+         * Number of subscribers in this subtree.
+         */
+        std::size_t count = 0;
+
+        [[nodiscard]] auto empty() const -> bool { return 0 == count; }
+    };
+
+    template <typename Callback>
+    static auto visit(const Node& node, const Segments& segments, std::size_t level, Callback& callback) -> void {
+        for (const auto& subscriber : node.subscribers) {
+            callback(subscriber);
+        }
+        if (Levels == level) {
+            return;
+        }
+        if (auto it = node.children.find(segments.key(level)); it != node.children.end()) {
+            visit(*it->second, segments, level + 1, callback);
+        }
+        if (node.wildcard) {
+            visit(*node.wildcard, segments, level + 1, callback);
+        }
+    }
+
+    /**
+     * Copy of a node, or a new node, with a subscriber added below it.
+     */
+    static auto with(const Node* node, const Segments& segments, std::size_t level,
+                     Subscriber subscriber) -> std::shared_ptr<Node> {
+        auto copy = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+        ++copy->count;
+        if (segments.depth() == level) {
+            copy->subscribers.push_back(std::move(subscriber));
+            return copy;
+        }
+        if (segments.isWildcard(level)) {
+            copy->wildcard = with(copy->wildcard.get(), segments, level + 1, std::move(subscriber));
+            return copy;
+        }
+        const Node* child = nullptr;
+        if (auto it = copy->children.find(segments.key(level)); it != copy->children.end()) {
+            child = it->second.get();
+        }
+        auto updated = with(child, segments, level + 1, std::move(subscriber));
+        if (nullptr == child) {
+            updated->key = std::string(segments.key(level));
+        }
+        copy->children.erase(segments.key(level));
+        copy->children.emplace(updated->key, std::move(updated));
+        return copy;
+    }
+
+    /**
+     * Copy of a node with a subscriber removed below it.
+     * @return nullptr if the copy would be empty.
+     */
+    static auto without(const Node& node, const Segments& segments, std::size_t level,
+                        const Subscriber& subscriber, bool& removed) -> std::shared_ptr<Node> {
+        auto copy = std::make_shared<Node>(node);
+        if (segments.depth() == level) {
+            auto it = std::find(copy->subscribers.begin(), copy->subscribers.end(), subscriber);
+            if (it == copy->subscribers.end()) {
+                return copy;
+            }
+            copy->subscribers.erase(it);
+            removed = true;
+        } else if (segments.isWildcard(level)) {
+            if (!copy->wildcard) {
+                return copy;
+            }
+            copy->wildcard = without(*copy->wildcard, segments, level + 1, subscriber, removed);
+        } else {
+            auto it = copy->children.find(segments.key(level));
+            if (it == copy->children.end()) {
+                return copy;
+            }
+            auto updated = without(*it->second, segments, level + 1, subscriber, removed);
+            copy->children.erase(it);
+            if (updated) {
+                copy->children.emplace(updated->key, std::move(updated));
+            }
+        }
+        if (removed) {
+            --copy->count;
+        }
+        return copy->empty() ? nullptr : copy;
+    }
+
+    /**
+     * Replace the root. Called with writeMutex_ held.
+     * @param root New root, nullptr when the trie is empty.
+     */
+    auto publish(std::shared_ptr<Node> root) -> void {
+        root_.publish(root ? std::make_unique<const Node>(std::move(*root)) : nullptr);
+    }
+
+    /**
+     * Current trie, nullptr when empty. The root is owned here, the nodes
+     * below it are shared between versions.
+     */
+    RcuPointer<Node> root_;
+    /**
+     * Serializes the updates.
+     */
+    std::mutex writeMutex_;
+
+}; // class UriMatcher
+
+} // namespace uprotocol::uri
+
+#endif // URI_MATCHER_H_
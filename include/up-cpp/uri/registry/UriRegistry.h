@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_REGISTRY_H_
+#define URI_REGISTRY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <up-core-api/uri.pb.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Handle of a URI interned in a UriRegistry. Two handles of the same
+ * registry are equal exactly when their URIs are identical, so comparing,
+ * hashing and ordering them costs a single integer operation.
+ */
+class UriHandle {
+public:
+    /**
+     * The invalid handle, not associated with any URI.
+     */
+    constexpr UriHandle() = default;
+
+    constexpr explicit UriHandle(uint32_t value) : value_(value) {}
+
+    [[nodiscard]] constexpr auto value() const -> uint32_t { return value_; }
+
+    /**
+     * @return false for the invalid handle.
+     */
+    [[nodiscard]] constexpr auto isValid() const -> bool { return value_ != 0; }
+
+    friend constexpr auto operator==(UriHandle lhs, UriHandle rhs) -> bool { return lhs.value_ == rhs.value_; }
+    friend constexpr auto operator!=(UriHandle lhs, UriHandle rhs) -> bool { return lhs.value_ != rhs.value_; }
+    friend constexpr auto operator<(UriHandle lhs, UriHandle rhs) -> bool { return lhs.value_ < rhs.value_; }
+
+private:
+    uint32_t value_ = 0;
+};
+
+/**
+ * Registry interning each distinct UUri once. A UUri is identified by all
+ * of its fields, names and ids alike: unlike operator== in Utils.h, a
+ * missing field is not a wildcard. The interned URI and its long and micro
+ * serializations live as long as the registry.
+ *
+ * Interning takes a lock, shared when the URI is already known. Resolving
+ * a handle is lock-free, so handles can be used freely on hot paths.
+ */
+class UriRegistry {
+public:
+    /**
+     * An interned URI.
+     */
+    struct Entry {
+        v1::UUri uri;
+        /**
+         * LongUriSerializer::serialize of the URI.
+         */
+        std::string longUri;
+        /**
+         * MicroUriSerializer::serialize of the URI, empty if it is not in micro form.
+         */
+        std::vector<uint8_t> microUri;
+    };
+
+    /**
+     * Number of entries allocated at once.
+     */
+    static constexpr std::size_t SegmentSize = 1024;
+    /**
+     * Maximum number of segments.
+     */
+    static constexpr std::size_t MaxSegments = 4096;
+    /**
+     * Maximum number of interned URIs.
+     */
+    static constexpr std::size_t MaxSize = SegmentSize * MaxSegments;
+    /**
+     * Maximum number of long format strings recorded as aliases of an
+     * interned URI, beyond which intern() deserializes new aliases every time.
+     */
+    static constexpr std::size_t MaxAliases = 4096;
+
+    /**
+     * @return the registry shared by the whole process.
+     */
+    static auto global() -> UriRegistry&;
+
+    UriRegistry() = default;
+    ~UriRegistry();
+
+    UriRegistry(const UriRegistry&) = delete;
+    UriRegistry& operator=(const UriRegistry&) = delete;
+
+    /**
+     * Intern a URI.
+     * @param uri URI to intern.
+     * @return Returns the handle of the URI, or the invalid handle if the URI
+     * is empty or the registry is full.
+     */
+    [[nodiscard]] auto intern(const v1::UUri& uri) -> UriHandle;
+
+    /**
+     * Intern a long format URI. Strings already seen are not deserialized again,
+     * up to MaxAliases strings that differ from the serialization of their URI,
+     * and strings deserializing to the same UUri get the same handle.
+     * @param long_uri A long format uProtocol URI.
+     * @return Returns the handle of the URI, or the invalid handle if the URI
+     * is invalid or the registry is full.
+     */
+    [[nodiscard]] auto intern(std::string_view long_uri) -> UriHandle;
+
+    /**
+     * Find an already interned URI, without interning it.
+     * @param uri URI to look for.
+     * @return Returns the handle of the URI, or the invalid handle if it is not interned.
+     */
+    [[nodiscard]] auto find(const v1::UUri& uri) const -> UriHandle;
+
+    /**
+     * Resolve a handle, without locking. Handles are numbered from 1 in each
+     * registry, so a handle is only meaningful with the registry that issued
+     * it: a handle of another registry may resolve to an unrelated entry.
+     * @param handle Handle returned by this registry.
+     * @return Returns the interned entry, nullptr for the invalid handle or a
+     * handle above size().
+     */
+    [[nodiscard]] auto lookup(UriHandle handle) const -> const Entry*;
+
+    /**
+     * @param handle Handle returned by this registry.
+     * @return Returns the interned URI, an empty UUri if lookup() returns nullptr.
+     */
+    [[nodiscard]] auto uri(UriHandle handle) const -> const v1::UUri&;
+
+    /**
+     * @param handle Handle returned by this registry.
+     * @return Returns the long format of the URI, empty if lookup() returns nullptr.
+     */
+    [[nodiscard]] auto longUri(UriHandle handle) const -> std::string_view;
+
+    /**
+     * @param handle Handle returned by this registry.
+     * @return Returns the micro format of the URI, empty if it has none or if lookup() returns nullptr.
+     */
+    [[nodiscard]] auto microUri(UriHandle handle) const -> const std::vector<uint8_t>&;
+
+    /**
+     * Number of interned URIs.
+     */
+    [[nodiscard]] auto size() const -> std::size_t { return size_.load(std::memory_order_acquire); }
+
+private:
+    /**
+     * Append an entry, called with the exclusive lock held.
+     * @param key Canonical key of the URI.
+     * @param uri URI to intern.
+     * @return Returns the handle of the new entry, or the invalid handle if the registry is full.
+     */
+    auto append(std::string key, const v1::UUri& uri) -> UriHandle;
+
+    /**
+     * Guards the indexes and appending to the entries.
+     */
+    mutable std::shared_mutex mutex_;
+    /**
+     * Index by canonical key, the deterministic protobuf encoding of the URI.
+     */
+    std::unordered_map<std::string, UriHandle> byKey_;
+    /**
+     * Index by long format string, including every alias seen by intern().
+     * The keys are views of Entry::longUri or of aliases_.
+     */
+    std::unordered_map<std::string_view, UriHandle> byLongUri_;
+    /**
+     * Long format strings that differ from the serialization of their URI,
+     * at most MaxAliases.
+     */
+    std::deque<std::string> aliases_;
+    /**
+     * Entries, in blocks that are never moved. Entries below size_ are immutable.
+     */
+    std::array<std::atomic<Entry*>, MaxSegments> segments_{};
+    std::atomic<std::size_t> size_{0};
+
+}; // class UriRegistry
+
+} // namespace uprotocol::uri
+
+namespace std {
+
+template <>
+struct hash<uprotocol::uri::UriHandle> {
+    auto operator()(uprotocol::uri::UriHandle handle) const noexcept -> std::size_t {
+        return std::hash<uint32_t>{}(handle.value());
+    }
+};
+
+} // namespace std
+
+#endif // URI_REGISTRY_H_
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef PERFECT_HASH_MAP_H_
+#define PERFECT_HASH_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace uprotocol::uri {
+
+/**
+ * Perfect hash construction with "hash and displace": keys are spread over
+ * small buckets, and each bucket gets the first seed that sends all its keys
+ * to free slots. Every key then has its own slot, so a lookup is two hashes
+ * and one key comparison, never a probe sequence. The hashes are the same
+ * on every platform, so an index can be stored and used by another process.
+ */
+class PerfectHash {
+public:
+    /**
+     * Seed of each bucket, and the key of each slot.
+     */
+    struct Index {
+        std::vector<uint32_t> seeds;
+        /**
+         * Position of the key of each slot in the built key set, or Empty.
+         */
+        std::vector<uint32_t> slots;
+    };
+
+    static constexpr uint32_t Empty = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * Seeded hash of a string.
+     * @param key String to hash.
+     * @param seed Seed, 0 selects the bucket.
+     * @param scope Namespace of the key, so equal strings of different scopes differ.
+     */
+    [[nodiscard]] static auto hash(std::string_view key, uint32_t seed, uint64_t scope = 0) -> uint64_t {
+        uint64_t h = 0x9e3779b97f4a7c15ULL * (seed + 1) + scope * 0xff51afd7ed558ccdULL;
+        for (const auto ch : key) {
+            h = (h ^ static_cast<unsigned char>(ch)) * 0x100000001b3ULL;
+        }
+        return finalize(h);
+    }
+
+    /**
+     * Seeded hash of an integer.
+     */
+    [[nodiscard]] static auto hash(uint64_t key, uint32_t seed) -> uint64_t {
+        return finalize((0x9e3779b97f4a7c15ULL * (seed + 1)) ^ key);
+    }
+
+    /**
+     * Build the index of distinct keys.
+     * @param count Number of keys.
+     * @param hash_of Called as hash_of(position, seed), returns the hash of a key.
+     * @return Returns the index.
+     */
+    template <typename HashOf>
+    [[nodiscard]] static auto build(std::size_t count, HashOf&& hash_of) -> Index {
+        Index index;
+        if (0 == count) {
+            return index;
+        }
+        // 4 keys per bucket and 25% free slots keep the seed search short
+        index.seeds.assign((count + 3) / 4, 0);
+        auto slot_count = count + count / 4 + 1;
+        while (!place(index, count, slot_count, hash_of)) {
+            slot_count += slot_count / 4 + 1;
+        }
+        return index;
+    }
+
+    /**
+     * Slot of a key.
+     * @param seeds Seeds of the index.
+     * @param buckets Number of seeds, not 0.
+     * @param slots Number of slots, not 0.
+     * @param hash_of Called as hash_of(seed), returns the hash of the key.
+     * @return Returns the slot the key has if it was indexed.
+     */
+    template <typename HashOf>
+    [[nodiscard]] static auto slotOf(const uint32_t* seeds, std::size_t buckets, std::size_t slots,
+                                     HashOf&& hash_of) -> std::size_t {
+        return hash_of(seeds[hash_of(0) % buckets]) % slots;
+    }
+
+private:
+    static constexpr uint32_t MaxSeed = 1U << 16;
+
+    [[nodiscard]] static auto finalize(uint64_t h) -> uint64_t {
+        // splitmix64 finalizer
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    /**
+     * Assign a seed to every bucket, the largest buckets first.
+     * @return false if a bucket found no seed, then more slots are needed.
+     */
+    template <typename HashOf>
+    static auto place(Index& index, std::size_t count, std::size_t slot_count, HashOf& hash_of) -> bool {
+        std::vector<std::vector<uint32_t>> buckets(index.seeds.size());
+        for (uint32_t i = 0; i < count; ++i) {
+            buckets[hash_of(i, 0) % buckets.size()].push_back(i);
+        }
+        std::vector<uint32_t> order(buckets.size());
+        for (uint32_t b = 0; b < order.size(); ++b) {
+            order[b] = b;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&buckets](auto lhs, auto rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+        index.slots.assign(slot_count, Empty);
+        std::vector<std::size_t> taken;
+        for (auto b : order) {
+            const auto& keys = buckets[b];
+            if (keys.empty()) {
+                break;
+            }
+            bool placed = false;
+            for (uint32_t seed = 1; seed < MaxSeed && !placed; ++seed) {
+                taken.clear();
+                placed = true;
+                for (auto i : keys) {
+                    const auto slot = hash_of(i, seed) % slot_count;
+                    if (Empty != index.slots[slot] || std::find(taken.begin(), taken.end(), slot) != taken.end()) {
+                        placed = false;
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+                if (placed) {
+                    index.seeds[b] = seed;
+                    for (std::size_t k = 0; k < keys.size(); ++k) {
+                        index.slots[taken[k]] = keys[k];
+                    }
+                }
+            }
+            if (!placed) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * Immutable map built once from a known set of keys, indexed with a PerfectHash.
+ *
+ * @tparam Key std::string, looked up by std::string_view, or an unsigned integer.
+ * @tparam Value Mapped type.
+ */
+template <typename Key, typename Value>
+class PerfectHashMap {
+public:
+    /**
+     * Type of the keys passed to find().
+     */
+    using KeyView = std::conditional_t<std::is_same_v<Key, std::string>, std::string_view, Key>;
+
+    PerfectHashMap() = default;
+
+    /**
+     * Build the map. If a key is given more than once, its first value is kept.
+     * @param entries Keys and their values.
+     */
+    explicit PerfectHashMap(std::vector<std::pair<Key, Value>> entries) {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        entries.erase(std::unique(entries.begin(), entries.end(),
+                                  [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; }),
+                      entries.end());
+        entries_ = std::move(entries);
+        index_ = PerfectHash::build(entries_.size(), [this](std::size_t i, uint32_t seed) {
+            return PerfectHash::hash(KeyView(entries_[i].first), seed);
+        });
+    }
+
+    /**
+     * Find the value of a key.
+     * @param key Key to look for.
+     * @return Returns the value, or nullptr if the key is not in the map.
+     */
+    [[nodiscard]] auto find(KeyView key) const -> const Value* {
+        if (entries_.empty()) {
+            return nullptr;
+        }
+        const auto slot = PerfectHash::slotOf(index_.seeds.data(), index_.seeds.size(), index_.slots.size(),
+                                              [key](uint32_t seed) { return PerfectHash::hash(key, seed); });
+        const auto position = index_.slots[slot];
+        if (PerfectHash::Empty == position || KeyView(entries_[position].first) != key) {
+            return nullptr;
+        }
+        return &entries_[position].second;
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return entries_.size(); }
+
+    [[nodiscard]] auto empty() const -> bool { return entries_.empty(); }
+
+    /**
+     * The keys and values, sorted by key.
+     */
+    [[nodiscard]] auto entries() const -> const std::vector<std::pair<Key, Value>>& { return entries_; }
+
+private:
+    std::vector<std::pair<Key, Value>> entries_;
+    PerfectHash::Index index_;
+};
+
+} // namespace uprotocol::uri
+
+#endif // PERFECT_HASH_MAP_H_
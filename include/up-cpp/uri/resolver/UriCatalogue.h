@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_CATALOGUE_H_
+#define URI_CATALOGUE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <up-cpp/uri/resolver/UriResolver.h>
+#include <up-core-api/uri.pb.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Read only catalogue of authority, entity and resource names and ids,
+ * stored in a compact binary file that is memory mapped and never parsed.
+ *
+ * The file holds the records, their strings, and perfect hash indexes by
+ * name and by id built when the file is written. Opening it maps the file
+ * and checks its header, so startup cost does not depend on the number of
+ * entries; pages are read from disk as lookups touch them, and are shared
+ * by every process that maps the same catalogue.
+ *
+ * Lookups return views of the mapped pages, valid while the catalogue is
+ * alive. The catalogue is immutable, so it can be shared between threads.
+ */
+class UriCatalogue {
+public:
+    using EntityMapping = UriResolver::EntityMapping;
+    using ResourceMapping = UriResolver::ResourceMapping;
+
+    /**
+     * Name of a remote authority and its id.
+     */
+    struct AuthorityMapping {
+        std::string name;
+        std::string id;
+    };
+
+    /**
+     * Write a catalogue file. A name or id given more than once keeps its
+     * first mapping, resources of unknown entities are ignored.
+     * @param path File to write, replaced if it exists.
+     * @param entities Entity names and ids.
+     * @param resources Resource names and ids.
+     * @param authorities Remote authority names and ids.
+     * @return false if the file cannot be written.
+     */
+    static auto write(const std::string& path,
+                      const std::vector<EntityMapping>& entities,
+                      const std::vector<ResourceMapping>& resources,
+                      const std::vector<AuthorityMapping>& authorities = {}) -> bool;
+
+    /**
+     * Map a catalogue file.
+     * @param path File written by write().
+     * @return Returns the catalogue, or nullptr if the file cannot be mapped or is not a catalogue.
+     */
+    [[nodiscard]] static auto open(const std::string& path) -> std::shared_ptr<const UriCatalogue>;
+
+    UriCatalogue(const UriCatalogue&) = delete;
+    auto operator=(const UriCatalogue&) -> UriCatalogue& = delete;
+    ~UriCatalogue();
+
+    /**
+     * Id of an entity.
+     * @param entity Name of the entity.
+     * @return std::nullopt if the entity is unknown.
+     */
+    [[nodiscard]] auto resolve(std::string_view entity) const -> std::optional<uint32_t>;
+
+    /**
+     * Id of a resource of an entity.
+     * @param entity_id Id of the entity.
+     * @param resource "name" or "name.instance", an optional "#message" is ignored.
+     * @return std::nullopt if the resource is unknown.
+     */
+    [[nodiscard]] auto resolve(uint32_t entity_id, std::string_view resource) const -> std::optional<uint32_t>;
+
+    /**
+     * Name of an entity.
+     * @param entity_id Id of the entity.
+     * @return Returns the name, empty if the entity is unknown.
+     */
+    [[nodiscard]] auto reverse(uint32_t entity_id) const -> std::string_view;
+
+    /**
+     * Resource of an entity as in the long format, "name.instance#message".
+     * @param entity_id Id of the entity.
+     * @param resource_id Id of the resource.
+     * @return Returns the resource, empty if it is unknown.
+     */
+    [[nodiscard]] auto reverse(uint32_t entity_id, uint32_t resource_id) const -> std::string_view;
+
+    /**
+     * Id of a remote authority.
+     * @return Returns the id, empty if the authority is unknown.
+     */
+    [[nodiscard]] auto resolveAuthority(std::string_view name) const -> std::string_view;
+
+    /**
+     * Name of a remote authority.
+     * @return Returns the name, empty if the authority is unknown.
+     */
+    [[nodiscard]] auto reverseAuthority(std::string_view id) const -> std::string_view;
+
+    /**
+     * Fill in the id of a named authority, or the name of an authority with an id.
+     * @return Returns the authority, unchanged if it is local or unknown.
+     */
+    [[nodiscard]] auto resolve(const v1::UAuthority& authority) const -> v1::UAuthority;
+
+    /**
+     * Fill in the id of a named entity, or the name of an entity with an id.
+     * @return Returns the entity, unchanged if it is unknown.
+     */
+    [[nodiscard]] auto resolve(const v1::UEntity& entity) const -> v1::UEntity;
+
+    /**
+     * Fill in the id of a named resource, or the name, instance and message of a resource with an id.
+     * @param resource Resource to resolve.
+     * @param entity_id Id of the entity owning the resource.
+     * @return Returns the resource, unchanged if it is unknown.
+     */
+    [[nodiscard]] auto resolve(const v1::UResource& resource, uint32_t entity_id) const -> v1::UResource;
+
+    /**
+     * Resolve the authority, entity and resource of a URI. A remote URI whose
+     * parts are all in the catalogue is then isResolved().
+     * @return Returns the URI with the names and ids found filled in.
+     */
+    [[nodiscard]] auto resolve(const v1::UUri& uri) const -> v1::UUri;
+
+    /**
+     * Number of entities.
+     */
+    [[nodiscard]] auto entityCount() const -> std::size_t;
+
+    /**
+     * Number of resources.
+     */
+    [[nodiscard]] auto resourceCount() const -> std::size_t;
+
+private:
+    UriCatalogue(const uint8_t* data, std::size_t size);
+
+    /**
+     * The mapped file.
+     */
+    const uint8_t* data_;
+    std::size_t size_;
+
+}; // class UriCatalogue
+
+} // namespace uprotocol::uri
+
+#endif // URI_CATALOGUE_H_
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_RESOLVER_H_
+#define URI_RESOLVER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <up-cpp/uri/resolver/PerfectHashMap.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Transcodes long format URI strings to micro format bytes and back, with
+ * name to id tables loaded once. No UUri is built: the long format is
+ * tokenized in place, and each name or id is resolved with a perfect hash.
+ *
+ * The micro bytes are the ones MicroUriSerializer::serialize gives for the
+ * deserialized long URI with its ids filled in, and the long strings the
+ * ones LongUriSerializer::serialize gives for it with its names filled in.
+ * The resolver is immutable, so it can be shared between threads.
+ */
+class UriResolver {
+public:
+    /**
+     * Name and id of a software entity.
+     */
+    struct EntityMapping {
+        std::string name;
+        uint16_t id;
+    };
+
+    /**
+     * Resource of an entity and its id.
+     */
+    struct ResourceMapping {
+        /**
+         * Id of the entity owning the resource.
+         */
+        uint16_t entityId;
+        /**
+         * Resource as in the long format: "name", "name.instance", optionally
+         * followed by "#message". Long URIs are resolved on name and instance,
+         * the message is restored by toLong().
+         */
+        std::string resource;
+        uint16_t id;
+    };
+
+    /**
+     * Name of a remote authority and its micro address.
+     */
+    struct AuthorityMapping {
+        std::string name;
+        /**
+         * IPv4 or IPv6 address, otherwise taken as the authority id.
+         */
+        std::string address;
+    };
+
+    /**
+     * Build the resolution tables. Mappings of unknown entities are ignored.
+     * @param entities Entity names and ids.
+     * @param resources Resource names and ids.
+     * @param authorities Remote authority names and addresses.
+     */
+    UriResolver(const std::vector<EntityMapping>& entities,
+                const std::vector<ResourceMapping>& resources,
+                const std::vector<AuthorityMapping>& authorities = {});
+
+    /**
+     * Transcode a long format URI to the micro format.
+     * @param long_uri A long format uProtocol URI.
+     * @param[out] micro_uri Replaced with the micro format. Reuse it across calls to avoid allocating.
+     * @return false if the URI is invalid or one of its names is unknown.
+     */
+    auto toMicro(std::string_view long_uri, std::vector<uint8_t>& micro_uri) const -> bool;
+
+    /**
+     * Transcode a long format URI to the micro format.
+     * @param long_uri A long format uProtocol URI.
+     * @return Returns the micro format, empty if the URI cannot be resolved.
+     */
+    [[nodiscard]] auto toMicro(std::string_view long_uri) const -> std::vector<uint8_t>;
+
+    /**
+     * Transcode a micro format URI to the long format.
+     * @param micro_uri The micro format URI.
+     * @param size Number of bytes of micro_uri.
+     * @param[out] long_uri Replaced with the long format. Reuse it across calls to avoid allocating.
+     * @return false if the URI is invalid or one of its ids is unknown.
+     */
+    auto toLong(const uint8_t* micro_uri, std::size_t size, std::string& long_uri) const -> bool;
+
+    /**
+     * Transcode a micro format URI to the long format.
+     * @param micro_uri The micro format URI.
+     * @return Returns the long format, empty if the URI cannot be resolved.
+     */
+    [[nodiscard]] auto toLong(const std::vector<uint8_t>& micro_uri) const -> std::string;
+
+    /**
+     * Id of an entity.
+     * @return nullptr if the entity is unknown.
+     */
+    [[nodiscard]] auto entityId(std::string_view name) const -> const uint16_t*;
+
+    /**
+     * Id of a resource of an entity.
+     * @param entity_id Id of the entity.
+     * @param resource "name" or "name.instance", an optional "#message" is ignored.
+     * @return nullptr if the resource is unknown.
+     */
+    [[nodiscard]] auto resourceId(uint16_t entity_id, std::string_view resource) const -> const uint16_t*;
+
+private:
+    /**
+     * An entity and its resources.
+     */
+    struct Entity {
+        std::string name;
+        uint16_t id = 0;
+        /**
+         * Resource ids by "name.instance".
+         */
+        PerfectHashMap<std::string, uint16_t> resourceIds;
+        /**
+         * Long format resources by id.
+         */
+        PerfectHashMap<uint32_t, std::string> resources;
+    };
+
+    /**
+     * Index in entities_ by name.
+     */
+    PerfectHashMap<std::string, uint32_t> entitiesByName_;
+    /**
+     * Index in entities_ by id.
+     */
+    PerfectHashMap<uint32_t, uint32_t> entitiesById_;
+    std::vector<Entity> entities_;
+    /**
+     * Micro address, the address type byte followed by the address bytes, by authority name.
+     */
+    PerfectHashMap<std::string, std::string> addresses_;
+    /**
+     * Authority name by micro address.
+     */
+    PerfectHashMap<std::string, std::string> authorities_;
+
+}; // class UriResolver
+
+} // namespace uprotocol::uri
+
+#endif // URI_RESOLVER_H_
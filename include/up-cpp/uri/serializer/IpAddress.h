@@ -25,11 +25,20 @@
 #ifndef IP_ADDRESS_H_
 #define IP_ADDRESS_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream> 
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace uprotocol::uri {
 
 /**
- * IpAddress holds the string and byte representaion.
+ * IpAddress holds the byte representation of an IPv4 or IPv6 address, and
+ * the text it was built from, inline, so that building one from a valid
+ * address does not allocate.
  */
 class IpAddress {
 
@@ -46,19 +55,38 @@ public:
     };
 
     /**
-     * Constructor with IP address in string format.
+     * Number of bytes in IPv4 address.
+     */
+    static constexpr uint8_t IpV4AddressBytes = 4;
+    /**
+     * Number of bytes in IPv6 address.
+     */
+    static constexpr uint8_t IpV6AddressBytes = 16;
+    /**
+     * Length of the longest text of an IPv4 or IPv6 address.
+     */
+    static constexpr std::size_t MaxTextLength = 45;
+
+    /**
+     * Constructor with IP address in string format. An empty string is a Local address.
      */
-    explicit IpAddress(std::string_view ipString) : ipString_(ipString) {
-        toBytes();
+    explicit IpAddress(std::string_view ipString) {
+        setText(ipString);
+        toBytes(ipString);
     }
 
     /**
      * Constructor with IP address in byte format.
      */
-    IpAddress(std::vector<uint8_t> const& ipBytes, AddressType type) : type_(type) , ipBytes_(ipBytes) {
-        toString();
+    IpAddress(std::vector<uint8_t> const& ipBytes, AddressType type) : IpAddress(ipBytes.data(), ipBytes.size(), type) {}
 
-    }
+    /**
+     * Constructor with IP address in byte format.
+     * @param ipBytes The address, at least 4 bytes for IpV4 and 16 for IpV6.
+     * @param size Number of bytes of ipBytes.
+     * @param type IpV4 or IpV6.
+     */
+    IpAddress(const uint8_t* ipBytes, std::size_t size, AddressType type);
 
     /**
      * Get the type of IP address.
@@ -66,47 +94,80 @@ public:
     auto getType() const { return type_; }
 
     /**
-     * Get the string format of IP address.
+     * Get the string format of IP address: the string it was built from, or
+     * normalized() when it was built from bytes.
      */
-    auto getString() const -> std::string { return ipString_; }
+    auto getString() const -> std::string;
 
     /**
-     * Get the byte format of IP address.
+     * Get the string format of IP address, normalized as inet_ntop formats it.
+     * Empty if the address is not IPv4 or IPv6.
      */
-    auto getBytes() const { return ipBytes_; }  
+    auto normalized() const -> std::string;
 
     /**
-     * Number of bytes in IPv4 address.
+     * Get a copy of the byte format of IP address. data() and size() do not copy.
      */
-    static constexpr uint8_t IpV4AddressBytes = 4;
+    auto getBytes() const { return std::vector<uint8_t>(data(), data() + size()); }
+
     /**
-     * Number of bytes in IPv6 address.
+     * The address bytes.
      */
-    static constexpr uint8_t IpV6AddressBytes = 16;
+    auto data() const -> const uint8_t* { return ipBytes_.data(); }
+
+    /**
+     * Number of address bytes: 4, 16, or 0 if the address is not IPv4 or IPv6.
+     */
+    auto size() const -> std::size_t { return length_; }
+
+    /**
+     * Normalize the text of an IP address, as inet_ntop would format it.
+     * IPv6 results are cached per thread, so repeated addresses are not parsed again.
+     * @param address IPv4 or IPv6 address.
+     * @param[out] normalized Replaced with the normalized text, unchanged if the address is not IPv4 or IPv6.
+     * @return Returns the type of the address, Invalid if it is not IPv4 or IPv6.
+     */
+    static auto normalize(std::string_view address, std::string& normalized) -> AddressType;
 
 private:
     /**
      * Updates the byte format of IP address and type, from the string format.
      */
-    void toBytes();
+    void toBytes(std::string_view ipString);
 
     /**
-     * Updates the string format of IP address.
+     * Keeps the string format the address is built from.
      */
-    void toString();
+    void setText(std::string_view ipString);
 
     /**
      * Type of the IP addess.
      */
     AddressType type_ = AddressType::Invalid;
+    /**
+     * Number of bytes of ipBytes_ in use.
+     */
+    uint8_t length_ = 0;
     /**
      * IP address in byte format.
      */
-    std::vector<uint8_t> ipBytes_{};
+    std::array<uint8_t, IpV6AddressBytes> ipBytes_{};
+    /**
+     * Whether the address was built from a string.
+     */
+    bool hasText_ = false;
+    /**
+     * Number of chars of text_ in use.
+     */
+    uint8_t textLength_ = 0;
+    /**
+     * String the address was built from, if up to MaxTextLength chars.
+     */
+    std::array<char, MaxTextLength> text_{};
     /**
-     * IP address in string format.
+     * String the address was built from, if longer. It is not an address then.
      */
-    std::string ipString_;
+    std::string longText_;
 
 }; // class IpAddress
 
@@ -29,8 +29,12 @@
 #include <up-cpp/uri/builder/BuildEntity.h>
 #include <up-cpp/uri/builder/BuildUAuthority.h>
 #include <up-cpp/uri/builder/BuildUUri.h>
+#include <up-cpp/uri/serializer/UriTokenizer.h>
 #include <up-cpp/uri/tools/Utils.h>
 #include <up-core-api/uri.pb.h>
+#include <fmt/format.h>
+#include <cstddef>
+#include <string>
 #include <string_view>
 
 namespace uprotocol::uri {
@@ -49,12 +53,53 @@ public:
      */
     static auto serialize(const v1::UUri& uri) -> std::string;
 
+    /**
+     * Serialize a UUri into a caller supplied string, replacing its content.
+     * The exact length is computed first, so nothing is allocated once the
+     * string has that capacity. Reuse the same string across calls.
+     * @param uri UUri object to be serialized to the String format.
+     * @param[out] out Receives the String format of the supplied UUri.
+     */
+    static auto serialize(const v1::UUri& uri, std::string& out) -> void;
+
+    /**
+     * Serialize a UUri into a caller supplied fmt buffer, replacing its content.
+     * @param uri UUri object to be serialized to the String format.
+     * @param[out] out Receives the String format of the supplied UUri.
+     */
+    static auto serialize(const v1::UUri& uri, fmt::memory_buffer& out) -> void;
+
+    /**
+     * Number of characters of the String format of a UUri, computed without
+     * building it.
+     * @param uri UUri object.
+     * @return Returns the length of serialize(uri).
+     */
+    [[nodiscard]] static auto serializedLength(const v1::UUri& uri) -> std::size_t;
+
+    /**
+     * Deserialize a String into a UUri object.
+     * The string is tokenized in place, without copying it.
+     * @param uProtocolUri A long format uProtocol URI.
+     * @return Returns an UUri data object.
+     */
+    static auto deserialize(std::string_view protocol_uri) -> v1::UUri;
+
     /**
      * Deserialize a String into a UUri object.
      * @param uProtocolUri A long format uProtocol URI.
      * @return Returns an UUri data object.
      */
-    static auto deserialize(std::string const& protocol_uri) -> v1::UUri;
+    static auto deserialize(const std::string& protocol_uri) -> v1::UUri;
+
+    /**
+     * Deserialize a null terminated String into a UUri object.
+     * @param uProtocolUri A long format uProtocol URI.
+     * @return Returns an UUri data object.
+     */
+    static auto deserialize(const char* protocol_uri) -> v1::UUri {
+        return deserialize(std::string_view(protocol_uri));
+    }
 
    /**
      * Create the resource part of the Uri from a resource object.
@@ -145,16 +190,12 @@ private:
     }
 
     /**
-     * Splits this string around matches of the given string delimiter.
-     * Trailing empty strings are therefore not included in the resulting array.
-     * @param str String to be split.
-     * @param delimiter Delimiter to split the string.
-     * @return Returns a vector of strings.
+     * Static factory method for creating a UResource using a string that contains
+     * name + instance + message.
+     * @param resource_string String that contains the UResource information.
+     * @return Returns a UResource object.
      */
-    [[nodiscard]] static auto split(std::string str,
-                      const std::string_view& delimiter) -> std::vector<std::string>;
-
-    [[nodiscard]] static auto parseUResource(const std::string& resource_string) -> v1::UResource;
+    [[nodiscard]] static auto parseUResource(std::string_view resource_string) -> v1::UResource;
 
     /**
      * Static factory method for creating a UEntity using a string that contains
@@ -163,35 +204,23 @@ private:
      * @param version String that contains the UEntity version.
      * @return Returns a UEntity object.
      */
-    [[nodiscard]] static auto parseUEntity(const std::string &entity, const std::string &version) -> v1::UEntity;
+    [[nodiscard]] static auto parseUEntity(std::string_view entity, std::string_view version) -> v1::UEntity;
 
     /**
-     * Static factory method for creating a UUri using a vector of strings that contains
-     * the Local UUri information.
-     * @param uri_parts Vector of strings that contains the Local UUri information.
+     * Static factory method for creating a UUri using the segments of
+     * a Local UUri.
+     * @param uri_parts Tokenized Local UUri.
      * @return Returns a v1::UUri object.
      */
-    [[nodiscard]] static auto parseLocalUUri(const std::vector<std::string>& uri_parts) -> v1::UUri;
+    [[nodiscard]] static auto parseLocalUUri(const UriTokenizer& uri_parts) -> v1::UUri;
 
     /**
-     * Static factory method for creating a UUri using a vector of strings that contains
-     * the Remote UUri information.
-     * @param uriParts Vector of strings that contains the Remote UUri information.
+     * Static factory method for creating a UUri using the segments of
+     * a Remote UUri.
+     * @param uri_parts Tokenized Remote UUri.
      * @return Returns a UUri object.
     */
-    [[nodiscard]] static auto parseRemoteUUri(const std::vector<std::string>& uri_parts) -> v1::UUri;
-    /**
-     * Verify if the given URI string is local
-     * @param uri 
-     * @return 
-     */
-    [[nodiscard]] static auto inline isLocality(const std::string_view &uri) -> bool;
-    /**
-     * find the first not empty value in the vector and return location
-     * @param uri_parts 
-     * @return 
-     */
-    [[nodiscard]] static auto inline getFirstNotEmpty(const std::vector<std::string> &uri_parts) -> uint64_t ;
+    [[nodiscard]] static auto parseRemoteUUri(const UriTokenizer& uri_parts) -> v1::UUri;
 }; // class LongUriSerializer
 
 } // namespace uprotocol::uri
@@ -30,6 +30,7 @@
 #include <up-cpp/uri/builder/BuildEntity.h>
 #include <up-cpp/uri/builder/BuildUResource.h>
 #include "up-cpp/uri/serializer/IpAddress.h"
+#include <up-cpp/uri/datamodel/MicroUri.h>
 
 using AddressType = uprotocol::uri::IpAddress::AddressType;
 
@@ -48,6 +49,15 @@ public:
      */
     [[nodiscard]] static auto serialize(const uprotocol::v1::UUri& u_uri) -> std::vector<uint8_t>;
 
+    /**
+     * Serialize a UUri into a caller provided buffer following the Micro-URI specifications, without allocating.
+     * @param u_uri The UUri data object.
+     * @param[out] micro_uri Buffer for the micro URI, MaxMicroUriLength bytes are always enough.
+     * @param capacity Number of bytes of micro_uri.
+     * @return Returns the number of bytes written, 0 if the UUri cannot be serialized or does not fit.
+     */
+    static auto serializeInto(const uprotocol::v1::UUri& u_uri, uint8_t* micro_uri, std::size_t capacity) -> std::size_t;
+
     /**
      * Deserialize a vector<uint8_t> into a UUri object.
      * @param microUri A vector<uint8_t> uProtocol micro URI.
@@ -55,6 +65,82 @@ public:
      */
     [[nodiscard]] static auto deserialize(std::vector<uint8_t> const& addr) -> uprotocol::v1::UUri;
 
+    /**
+     * Deserialize micro URI bytes into a UUri object, without copying them.
+     * @param micro_uri A uProtocol micro URI.
+     * @param size Number of bytes of micro_uri.
+     * @return Returns an UUri data object from the serialized format of a microUri.
+     */
+    [[nodiscard]] static auto deserialize(const uint8_t* micro_uri, std::size_t size) -> uprotocol::v1::UUri;
+
+    /**
+     * Convert a UUri to a MicroUri, the value serialize would write.
+     * @param u_uri The UUri data object. An id authority is viewed, not copied, by micro_uri.
+     * @param[out] micro_uri The micro URI.
+     * @return false if the UUri cannot be serialized in the micro format.
+     */
+    static auto toMicroUri(const uprotocol::v1::UUri& u_uri, MicroUri& micro_uri) -> bool;
+
+    /**
+     * Convert a MicroUri to a UUri, the one deserialize gives for its micro format.
+     * @param micro_uri The micro URI.
+     * @return Returns an UUri data object.
+     */
+    [[nodiscard]] static auto toUUri(const MicroUri& micro_uri) -> uprotocol::v1::UUri;
+
+    /**
+     * Implementations of deserializeLocalBatch.
+     */
+    enum class BatchKernel : uint8_t {
+        /** Portable implementation */
+        Scalar,
+        /** x86 SSE4.1 implementation */
+        Sse41,
+        /** x86 AVX2 implementation */
+        Avx2
+    };
+
+    /**
+     * Selects the implementation of deserializeLocalBatch. By default the best one supported by the CPU is used.
+     * @param kernel Implementation to use.
+     * @return false if the CPU does not support it. The selection is then unchanged.
+     */
+    static auto setBatchKernel(BatchKernel kernel) -> bool;
+
+    /**
+     * @return the implementation of deserializeLocalBatch.
+     */
+    [[nodiscard]] static auto getBatchKernel() -> BatchKernel;
+
+    /**
+     * Deserialize local micro URIs stored back to back, LocalMicroUriLength bytes each, into
+     * one array per field, without building UUris or logging. A URI is valid when its version
+     * is UpVersion and its address type is Local, or Invalid as serialize writes.
+     * @param micro_uris Array of count * LocalMicroUriLength bytes.
+     * @param count Number of URIs.
+     * @param[out] entity_ids Array of count entity ids.
+     * @param[out] entity_versions Array of count entity major versions.
+     * @param[out] resource_ids Array of count resource ids.
+     * @param[out] invalid Array of (count + 63) / 64 words, bit i % 64 of word i / 64 is set when URI i
+     * is invalid. The fields of an invalid URI are 0.
+     * @return Number of valid URIs.
+     */
+    static auto deserializeLocalBatch(const uint8_t* micro_uris, std::size_t count, uint16_t* entity_ids,
+                                      uint8_t* entity_versions, uint16_t* resource_ids, uint64_t* invalid) -> std::size_t;
+
+    /**
+     * The length of a local micro URI.
+     */
+    static constexpr uint32_t LocalMicroUriLength = 8;
+    /**
+     * the max size of id string in the micro URI.
+     */
+    static constexpr uint8_t UAutorityIdMaxLength = 255;
+    /**
+     * The length of the longest micro URI, with an id of UAutorityIdMaxLength bytes.
+     */
+    static constexpr std::size_t MaxMicroUriLength = LocalMicroUriLength + 1 + UAutorityIdMaxLength;
+
 private:
     /**
      * Default MicroUriSerializer constructor.
@@ -76,29 +162,18 @@ private:
     /**
      * Get UAthority from the address and type
      * @param addr 
+     * @param size number of bytes of addr
      * @param type 
      * @return uprotocol::v1::UAuthority if address is not valid UAuthority return empty
      */
-    [[nodiscard]] static auto getUauthority(const std::vector<uint8_t> &addr, AddressType type) -> uprotocol::v1::UAuthority;
+    [[nodiscard]] static auto getUauthority(const uint8_t* addr, std::size_t size, AddressType type) -> uprotocol::v1::UAuthority;
     /**
      * Debug function to print the ip address
      * @param ip 
      * @return 
      */
     [[maybe_unused]] static auto printIp(std::vector<uint8_t> ip);
-    
-    /**
-     * Add the ip address to the micro URI
-     * @param u_uri vector of uint8_t representing the micro URI
-     * @param uri uprotocol::v1::UUri
-     * @param address String of the ip address or the ID
-     */
-    [[maybe_unused]] static auto addIpOrId(const uprotocol::v1::UUri &u_uri, std::vector<uint8_t> &uri, std::string &address) -> void;
-    
-    /**
-         * The length of a local micro URI.
-         */
-    static constexpr uint32_t LocalMicroUriLength = 8;
+
     /**
      * The length of a IPv4 micro URI.
      */
@@ -123,10 +198,6 @@ private:
      * UE version position in the micro URI.
      */
     static constexpr uint8_t UeVersionPosition = EntityIdStartPosition + 2;
-    /**
-     * the max size of id string in the micro URI. 
-     */
-    static constexpr uint8_t UAutorityIdMaxLength = 255;
     /**
      * The version of the UProtocol.
      */
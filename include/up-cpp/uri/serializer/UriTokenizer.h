@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_TOKENIZER_H_
+#define URI_TOKENIZER_H_
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace uprotocol::uri {
+
+/**
+ * Single pass tokenizer of a long format URI into its '/' separated segments.
+ * '\' is accepted as a separator as well. The segments are views into the
+ * tokenized string, so the string must outlive the tokenizer. Nothing is allocated.
+ * Only the first MaxTokens segments are kept since no segment past them
+ * is used by the long URI format, but all the segments are counted.
+ */
+class UriTokenizer {
+public:
+    /**
+     * Number of segments kept: "//authority/entity/version/resource".
+     */
+    static constexpr std::size_t MaxTokens = 6;
+
+    /**
+     * Tokenize the given URI.
+     * @param uri Long format URI. Must outlive the tokenizer.
+     */
+    explicit constexpr UriTokenizer(std::string_view uri) noexcept : uri_(uri) {
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < uri.size(); ++i) {
+            if (isSeparator(uri[i])) {
+                addToken(uri.substr(start, i - start));
+                start = i + 1;
+            }
+        }
+        addToken(uri.substr(start));
+    }
+
+    /**
+     * Is the character a segment separator.
+     * @param ch Character to check.
+     * @return true for '/' and '\'.
+     */
+    [[nodiscard]] static constexpr auto isSeparator(char ch) noexcept -> bool {
+        return '/' == ch || '\\' == ch;
+    }
+
+    /**
+     * Number of segments in the URI, including empty ones.
+     * An empty string has one empty segment.
+     */
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return count_; }
+
+    /**
+     * Get a segment of the URI.
+     * @param index Segment position.
+     * @return The segment, or an empty view if index is not one of the kept segments.
+     */
+    [[nodiscard]] constexpr auto operator[](std::size_t index) const noexcept -> std::string_view {
+        return index < MaxTokens ? tokens_[index] : std::string_view();
+    }
+
+    /**
+     * Number of empty segments before the first non empty segment.
+     */
+    [[nodiscard]] constexpr auto firstNotEmpty() const noexcept -> std::size_t { return firstNotEmpty_; }
+
+    /**
+     * Is the URI local. A URI is remote only if it starts with exactly two separators.
+     */
+    [[nodiscard]] constexpr auto isLocal() const noexcept -> bool {
+        if (uri_.size() < 2 || !isSeparator(uri_[0]) || !isSeparator(uri_[1])) {
+            return true;
+        }
+        return uri_.size() > 2 && isSeparator(uri_[2]);
+    }
+
+private:
+    constexpr auto addToken(std::string_view token) noexcept -> void {
+        if (count_ < MaxTokens) {
+            tokens_[count_] = token;
+        }
+        if (count_ == firstNotEmpty_ && token.empty()) {
+            ++firstNotEmpty_;
+        }
+        ++count_;
+    }
+
+    /**
+     * The tokenized URI.
+     */
+    std::string_view uri_;
+    /**
+     * The first MaxTokens segments.
+     */
+    std::array<std::string_view, MaxTokens> tokens_{};
+    /**
+     * Total number of segments.
+     */
+    std::size_t count_ = 0;
+    /**
+     * Number of leading empty segments.
+     */
+    std::size_t firstNotEmpty_ = 0;
+
+}; // class UriTokenizer
+
+} // namespace uprotocol::uri
+
+#endif // URI_TOKENIZER_H_
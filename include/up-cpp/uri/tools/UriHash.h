@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef URI_HASH_H_
+#define URI_HASH_H_
+
+#include <cstddef>
+#include <string_view>
+#include <up-core-api/uri.pb.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Hash of UUri and of its parts, consistent with UriEqual, so that URIs
+ * can key unordered containers. A UUri and its long format string hash
+ * the same, and the functor is transparent, so containers supporting
+ * heterogeneous lookup can be searched with a string_view.
+ */
+struct UriHash {
+    using is_transparent = void;
+
+    [[nodiscard]] auto operator()(const v1::UUri& uri) const -> std::size_t;
+
+    /**
+     * @param long_uri A long format URI, as returned by LongUriSerializer::serialize.
+     */
+    [[nodiscard]] auto operator()(std::string_view long_uri) const -> std::size_t;
+
+    [[nodiscard]] auto operator()(const v1::UAuthority& authority) const -> std::size_t;
+
+    [[nodiscard]] auto operator()(const v1::UEntity& entity) const -> std::size_t;
+
+    [[nodiscard]] auto operator()(const v1::UResource& resource) const -> std::size_t;
+};
+
+/**
+ * Strict equality of UUri and of its parts. Unlike operator== in Utils.h,
+ * a missing field is not a wildcard: numeric fields must both be missing or
+ * both be set to the same value. An unset string equals an empty one, as
+ * in the long format.
+ *
+ * A UUri equals a long format string when it has no micro form field (ip,
+ * id) and LongUriSerializer::serialize would return that exact string.
+ * This compares the normalized long form, not the fields: serialize trims
+ * the entity name and drops what the long format can not express, so
+ * several UUris that differ under the strict UUri comparison can equal
+ * the same string. E.g. entity names "body.access" and " body.access "
+ * both equal "/body.access/1". A heterogeneous lookup with a string then
+ * finds any key whose long form is that string; containers keyed by
+ * UUris that only differ that way should be searched with a UUri.
+ */
+struct UriEqual {
+    using is_transparent = void;
+
+    [[nodiscard]] auto operator()(const v1::UUri& lhs, const v1::UUri& rhs) const -> bool;
+
+    /**
+     * @return true if the normalized long form of lhs is exactly rhs.
+     */
+    [[nodiscard]] auto operator()(const v1::UUri& lhs, std::string_view rhs) const -> bool;
+
+    [[nodiscard]] auto operator()(std::string_view lhs, const v1::UUri& rhs) const -> bool {
+        return (*this)(rhs, lhs);
+    }
+
+    [[nodiscard]] auto operator()(std::string_view lhs, std::string_view rhs) const -> bool {
+        return lhs == rhs;
+    }
+
+    [[nodiscard]] auto operator()(const v1::UAuthority& lhs, const v1::UAuthority& rhs) const -> bool;
+
+    [[nodiscard]] auto operator()(const v1::UEntity& lhs, const v1::UEntity& rhs) const -> bool;
+
+    [[nodiscard]] auto operator()(const v1::UResource& lhs, const v1::UResource& rhs) const -> bool;
+};
+
+} // namespace uprotocol::uri
+
+#endif // URI_HASH_H_
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef LONG_URI_VALIDATOR_H_
+#define LONG_URI_VALIDATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <up-cpp/uri/serializer/UriTokenizer.h>
+
+namespace uprotocol::uri {
+
+/**
+ * Validation of a long format URI in a single scan of the string, without
+ * building the UUri. A URI is valid when LongUriSerializer::deserialize
+ * returns a non empty UUri: the same segments are read, names made of blanks
+ * are ignored and versions are read the way std::stoi reads them. A URI that
+ * makes deserialize throw, e.g. with a version that is not a number, is invalid.
+ */
+class LongUriValidator {
+public:
+    /**
+     * Is the long format URI valid.
+     * @param uri Long format URI.
+     * @return true if deserializing the URI gives a non empty UUri.
+     */
+    [[nodiscard]] static constexpr auto isValid(std::string_view uri) noexcept -> bool {
+        if (uri.empty()) {
+            return false;
+        }
+        // remote URIs start with exactly two separators
+        const bool remote = !UriTokenizer(uri.substr(0, 3)).isLocal();
+        constexpr auto None = SIZE_MAX;
+        const std::size_t authority_index = remote ? 2 : None;
+        std::size_t entity_index = remote ? 3 : None;
+
+        std::size_t index = 0;
+        std::size_t leading_empty = 0;
+        bool token_empty = true;
+        bool seen_not_empty = false;
+        bool authority_blank = true;
+        bool entity_empty = true;
+        bool entity_blank = true;
+        Version version;
+
+        for (auto ch : uri) {
+            if (UriTokenizer::isSeparator(ch)) {
+                if (!seen_not_empty) {
+                    ++leading_empty;
+                }
+                ++index;
+                token_empty = true;
+                continue;
+            }
+            if (token_empty) {
+                token_empty = false;
+                if (!seen_not_empty) {
+                    seen_not_empty = true;
+                    if (!remote) {
+                        // the entity of a local URI is its first non empty segment
+                        entity_index = index;
+                    }
+                }
+            }
+            if (index == authority_index) {
+                authority_blank = authority_blank && isSpace(ch);
+            } else if (index == entity_index) {
+                entity_empty = false;
+                entity_blank = entity_blank && isSpace(ch);
+            } else if (None != entity_index && index == entity_index + 1) {
+                version.feed(ch);
+            }
+        }
+        auto count = index + 1;
+        if (!seen_not_empty) {
+            ++leading_empty;
+        }
+
+        if (leading_empty > 3 || count < 2 || !seen_not_empty) {
+            return false;
+        }
+        auto version_result = version.result();
+        if (remote) {
+            // the entity, and its version, are only read if it has a name
+            return count >= 3 && !authority_blank &&
+                   (count <= 3 || entity_empty || Version::Throws != version_result);
+        }
+        return Version::Throws != version_result &&
+               (!entity_blank || Version::Major == version_result);
+    }
+
+private:
+    /**
+     * Same white spaces as std::isspace in the "C" locale.
+     */
+    [[nodiscard]] static constexpr auto isSpace(char ch) noexcept -> bool {
+        return ' ' == ch || ('\t' <= ch && ch <= '\r');
+    }
+
+    /**
+     * State machine of std::stoi: white spaces, an optional sign and digits.
+     * Anything after the digits is ignored.
+     */
+    struct Integer {
+        enum State : uint8_t { Space, Sign, Digits, Stop, Fail };
+
+        constexpr auto feed(char ch) noexcept -> void {
+            const bool digit = '0' <= ch && ch <= '9';
+            switch (state) {
+                case Space:
+                    if (isSpace(ch)) {
+                        return;
+                    }
+                    if ('+' == ch || '-' == ch) {
+                        negative = '-' == ch;
+                        state = Sign;
+                        return;
+                    }
+                    [[fallthrough]];
+                case Sign:
+                    state = digit ? Digits : Fail;
+                    magnitude = digit ? ch - '0' : 0;
+                    return;
+                case Digits:
+                    if (digit) {
+                        // saturate, anything past the int range throws anyway
+                        magnitude = magnitude * 10 + (ch - '0');
+                        magnitude = magnitude > Limit ? Limit : magnitude;
+                    } else {
+                        state = Stop;
+                    }
+                    return;
+                default:
+                    return;
+            }
+        }
+
+        /**
+         * Does std::stoi throw std::invalid_argument or std::out_of_range.
+         */
+        [[nodiscard]] constexpr auto throws() const noexcept -> bool {
+            return (Digits != state && Stop != state) ||
+                   magnitude > (negative ? Limit - 1 : Limit - 2);
+        }
+
+        [[nodiscard]] constexpr auto isNegative() const noexcept -> bool {
+            return negative && 0 != magnitude;
+        }
+
+        /** INT_MAX + 2 */
+        static constexpr uint64_t Limit = 2147483649ULL;
+
+        State state = Space;
+        bool negative = false;
+        uint64_t magnitude = 0;
+    };
+
+    /**
+     * State machine of BuildUEntity::setVersion: "major" or "major.minor".
+     */
+    struct Version {
+        enum Result : uint8_t { Empty, Throws, NoMajor, Major };
+
+        constexpr auto feed(char ch) noexcept -> void {
+            empty = false;
+            if (dot) {
+                minor.feed(ch);
+            } else if ('.' == ch) {
+                dot = true;
+            } else {
+                major.feed(ch);
+            }
+        }
+
+        [[nodiscard]] constexpr auto result() const noexcept -> Result {
+            if (empty) {
+                return Empty;
+            }
+            if (major.throws() || (dot && minor.throws())) {
+                return Throws;
+            }
+            // a negative major version alone is ignored
+            return (!dot && major.isNegative()) ? NoMajor : Major;
+        }
+
+        Integer major;
+        Integer minor;
+        bool dot = false;
+        bool empty = true;
+    };
+
+}; // class LongUriValidator
+
+} // namespace uprotocol::uri
+
+#endif // LONG_URI_VALIDATOR_H_
@@ -25,14 +25,13 @@
 #ifndef URI_VALIDATOR_H_
 #define URI_VALIDATOR_H_
 
-#include <up-cpp/uri/serializer/LongUriSerializer.h>
-#include <up-cpp/uri/tools/Utils.h>
+#include <string_view>
+#include <up-cpp/uri/validator/LongUriValidator.h>
 
 namespace uprotocol::uri {
 
-bool valid_uri(const std::string& uri) {
-    auto uri_view = LongUriSerializer::deserialize(uri);
-    return !isEmpty(uri_view);
+inline bool valid_uri(std::string_view uri) {
+    return LongUriValidator::isValid(uri);
 }
 
 }  // namespace uprotocol::uri
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _RAW_UUID_H_
+#define _RAW_UUID_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace uprotocol::uuid {
+
+/**
+ * The 128 bits of a UUID, without the protobuf UUID wrapper.
+ * Trivially copyable so ids can be generated and stored in contiguous arrays.
+ */
+struct RawUuid {
+    /** Most significant 64 bits: timestamp, version and counter */
+    uint64_t msb;
+    /** Least significant 64 bits: variant and random bits */
+    uint64_t lsb;
+
+    /**
+     * @return the Unix time in milliseconds at which the UUID was generated
+     */
+    constexpr uint64_t getTime() const noexcept { return msb >> 16; }
+
+    /**
+     * @return the counter of UUIDs generated in the same millisecond
+     */
+    constexpr uint64_t getCount() const noexcept { return msb & 0xFFFL; }
+};
+
+/**
+ * Total order of UUIDs: by msb then lsb. For UUID v8 this is the order of
+ * generation time, then counter.
+ */
+constexpr bool operator==(const RawUuid &s, const RawUuid &o) noexcept {
+    return s.msb == o.msb && s.lsb == o.lsb;
+}
+
+constexpr bool operator!=(const RawUuid &s, const RawUuid &o) noexcept {
+    return !(s == o);
+}
+
+constexpr bool operator<(const RawUuid &s, const RawUuid &o) noexcept {
+    return s.msb < o.msb || (s.msb == o.msb && s.lsb < o.lsb);
+}
+
+constexpr bool operator>(const RawUuid &s, const RawUuid &o) noexcept {
+    return o < s;
+}
+
+constexpr bool operator<=(const RawUuid &s, const RawUuid &o) noexcept {
+    return !(o < s);
+}
+
+constexpr bool operator>=(const RawUuid &s, const RawUuid &o) noexcept {
+    return !(s < o);
+}
+
+/**
+ * Hash of the msb/lsb pair. The lsb of all the UUIDs generated by a process
+ * can be the same and consecutive msb only differ in their low bits, so both
+ * halves are mixed into every bit of the result.
+ */
+constexpr std::size_t hashUuid(uint64_t msb, uint64_t lsb) noexcept {
+    uint64_t h = msb ^ ((lsb << 32) | (lsb >> 32));
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(h ^ (h >> 31));
+}
+
+} // namespace uprotocol::uuid
+
+namespace std {
+
+template<>
+struct hash<uprotocol::uuid::RawUuid> {
+    constexpr std::size_t operator()(const uprotocol::uuid::RawUuid &uuid) const noexcept {
+        return uprotocol::uuid::hashUuid(uuid.msb, uuid.lsb);
+    }
+};
+
+} // namespace std
+
+#endif // _RAW_UUID_H_
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _UUID_COMPARE_H_
+#define _UUID_COMPARE_H_
+
+#include <cstddef>
+#include <functional>
+#include <up-cpp/uuid/datamodel/RawUuid.h>
+#include <up-core-api/uuid.pb.h>
+
+namespace uprotocol::v1 {
+
+/**
+ * Total order of protobuf UUIDs, the same as the RawUuid order: by msb then lsb.
+ * Declared in the namespace of UUID so that they are found by argument
+ * dependent lookup, e.g. by std::less and std::equal_to.
+ */
+inline bool operator==(const UUID &s, const UUID &o) noexcept {
+    return s.msb() == o.msb() && s.lsb() == o.lsb();
+}
+
+inline bool operator!=(const UUID &s, const UUID &o) noexcept {
+    return !(s == o);
+}
+
+inline bool operator<(const UUID &s, const UUID &o) noexcept {
+    return s.msb() < o.msb() || (s.msb() == o.msb() && s.lsb() < o.lsb());
+}
+
+inline bool operator>(const UUID &s, const UUID &o) noexcept {
+    return o < s;
+}
+
+inline bool operator<=(const UUID &s, const UUID &o) noexcept {
+    return !(o < s);
+}
+
+inline bool operator>=(const UUID &s, const UUID &o) noexcept {
+    return !(s < o);
+}
+
+} // namespace uprotocol::v1
+
+namespace std {
+
+template<>
+struct hash<uprotocol::v1::UUID> {
+    std::size_t operator()(const uprotocol::v1::UUID &uuid) const noexcept {
+        return uprotocol::uuid::hashUuid(uuid.msb(), uuid.lsb());
+    }
+};
+
+} // namespace std
+
+#endif // _UUID_COMPARE_H_
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _ID_DEDUPLICATOR_H_
+#define _ID_DEDUPLICATOR_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <up-cpp/uuid/datamodel/RawUuid.h>
+#include <up-core-api/uuid.pb.h>
+
+namespace uprotocol::uuid {
+using namespace uprotocol::v1;
+
+/**
+ * Bounded cache of recently received message ids, to drop the duplicates
+ * a transport may deliver, e.g. after a reconnect.
+ *
+ * The ids are kept in a ring, in arrival order, and their fingerprints in a
+ * cuckoo filter. An id leaves the cache once it arrived more than the window
+ * ago, or when the ring is full. The window is anchored to the local clock,
+ * Uuidv8Factory::now(), so an id dated in the future or a sender with a
+ * clock behind can not make other ids expire.
+ * Lookups with contains() are O(1) and lock-free; insert() is serialized.
+ *
+ * The filter only stores 32 bit fingerprints, so a new id may be taken for
+ * a duplicate with the probability given by falsePositiveRate().
+ */
+class IdDeduplicator {
+public:
+    /** Default maximum number of ids */
+    static constexpr std::size_t DefaultCapacity = 65536;
+
+    /** Default time window */
+    static constexpr std::chrono::milliseconds DefaultWindow{10000};
+
+    /**
+     * Outcome of insert().
+     */
+    enum class Result : uint8_t {
+        /** The id was not in the cache, it is now */
+        New,
+        /** The id is in the cache (or is a false positive) */
+        Duplicate,
+        /**
+         * The id was not in the cache, but its v8 timestamp is older than
+         * the window: an earlier copy may already have left the cache, or
+         * the clock of the sender is behind. It is recorded like a new id,
+         * and whether to process it is up to the caller.
+         */
+        Expired
+    };
+
+    /**
+     * @param window Time window, compared to the local clock.
+     * @param capacity Maximum number of ids, rounded up to a power of 2.
+     */
+    explicit IdDeduplicator(std::chrono::milliseconds window = DefaultWindow,
+                            std::size_t capacity = DefaultCapacity);
+
+    IdDeduplicator(const IdDeduplicator &) = delete;
+    IdDeduplicator &operator=(const IdDeduplicator &) = delete;
+
+    /**
+     * Records a received id. Its v8 timestamp is clamped to the local clock,
+     * so an id dated in the future is treated as sent now.
+     * @param id Message id.
+     * @return Result::New, Result::Duplicate, or Result::Expired if the id
+     * is older than the window and can not be fully checked anymore.
+     */
+    Result insert(const RawUuid &id);
+
+    /**
+     * Records a received id.
+     * @param id Message id.
+     * @return the outcome, see insert(const RawUuid &).
+     */
+    Result insert(const UUID &id) { return insert(RawUuid{id.msb(), id.lsb()}); }
+
+    /**
+     * Lock-free lookup. Retries when insert() moved fingerprints between
+     * buckets during the lookup, so an id in the cache is never missed.
+     * @param id Message id.
+     * @return true if the id is in the cache (or is a false positive).
+     */
+    bool contains(const RawUuid &id) const;
+
+    /**
+     * Lock-free lookup.
+     * @param id Message id.
+     * @return true if the id is in the cache.
+     */
+    bool contains(const UUID &id) const { return contains(RawUuid{id.msb(), id.lsb()}); }
+
+    /**
+     * Changes the time window. A shorter window applies at the next insert().
+     * @param window Time window.
+     */
+    void setWindow(std::chrono::milliseconds window) { window_.store(window.count(), std::memory_order_relaxed); }
+
+    /**
+     * @return the time window.
+     */
+    std::chrono::milliseconds getWindow() const {
+        return std::chrono::milliseconds(window_.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * Removes all the ids.
+     */
+    void clear();
+
+    /**
+     * @return the number of ids in the cache.
+     */
+    std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return the maximum number of ids.
+     */
+    std::size_t capacity() const { return ringMask_ + 1; }
+
+    /**
+     * @return the number of insert() that found a duplicate.
+     */
+    uint64_t duplicates() const { return duplicates_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return the number of insert() that returned Result::Expired.
+     */
+    uint64_t expired() const { return expired_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return the probability that a new id is taken for a duplicate,
+     * at the current filling of the cache.
+     */
+    double falsePositiveRate() const;
+
+private:
+    /** Number of fingerprints in a bucket */
+    static constexpr std::size_t SlotsPerBucket = 4;
+
+    /** Maximum length of a cuckoo eviction path */
+    static constexpr std::size_t MaxKicks = 32;
+
+    /**
+     * Position of an id in the filter.
+     */
+    struct Key {
+        uint32_t fingerprint;
+        std::size_t bucket1;
+        std::size_t bucket2;
+    };
+
+    Key key(const RawUuid &id) const;
+
+    std::size_t altBucket(std::size_t bucket, uint32_t fingerprint) const;
+
+    /**
+     * Adds a fingerprint to the filter, moving others along a cuckoo path
+     * if both its buckets are full.
+     * @return false if no free slot was found.
+     */
+    bool add(const Key &key);
+
+    /**
+     * Removes a fingerprint from the filter.
+     */
+    void remove(const Key &key);
+
+    /**
+     * Removes the oldest id of the ring.
+     */
+    void evictOldest();
+
+    /** Ring size - 1, the size being a power of 2 */
+    std::size_t ringMask_;
+
+    /** Number of buckets - 1, a power of 2 minus 1 */
+    std::size_t bucketMask_;
+
+    /** Fingerprints, 0 for an empty slot */
+    std::unique_ptr<std::atomic<uint32_t>[]> slots_;
+
+    /**
+     * An id and its local arrival time.
+     */
+    struct Entry {
+        RawUuid id;
+        uint64_t arrival;
+    };
+
+    /** Ids in arrival order, between head_ and tail_ */
+    std::vector<Entry> ring_;
+    std::size_t head_ = 0;
+    std::size_t tail_ = 0;
+
+    /** Serializes insert() and clear() */
+    std::mutex mutex_;
+
+    /** State of the random cuckoo walk */
+    uint64_t walk_ = 0x9E3779B97F4A7C15ULL;
+
+    /** Odd while add() moves fingerprints, incremented before and after */
+    std::atomic<uint64_t> moves_{0};
+
+    std::atomic<int64_t> window_;
+    std::atomic<std::size_t> size_{0};
+    std::atomic<uint64_t> duplicates_{0};
+    std::atomic<uint64_t> expired_{0};
+
+}; // class IdDeduplicator
+
+} // namespace uprotocol::uuid
+
+#endif // _ID_DEDUPLICATOR_H_
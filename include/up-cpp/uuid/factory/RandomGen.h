@@ -26,18 +26,93 @@
 #ifndef __RANDOM_GEN_H__
 #define __RANDOM_GEN_H__
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <random>
+#include <pthread.h>
 
+/**
+ * Per thread source of 64 bit random numbers.
+ * Each thread lazily seeds its own std::mt19937_64 from std::random_device
+ * on first use, so a random number costs no syscall and no engine setup.
+ * The engines are reseeded after fork(), so that parent and child processes
+ * do not produce the same sequence.
+ */
 class RandomGenerator {
 
     public:
+        /**
+         * @return a random number in range [1, UINT64_MAX]
+         */
         static uint64_t GenerateRandom() {
+            auto &rng = engine();
+            uint64_t value = rng();
+            while (0 == value) {
+                value = rng();
+            }
+            return value;
+        }
+
+        /**
+         * Fills an array with random numbers in range [0, UINT64_MAX].
+         * @param[out] values Array of at least count elements.
+         * @param count Number of random numbers to generate.
+         */
+        static void fill(uint64_t *values, std::size_t count) {
+            std::generate_n(values, count, std::ref(engine()));
+        }
 
-            std::random_device dev;
-            std::mt19937 rng(dev());
-            std::uniform_int_distribution<std::mt19937::result_type> dist_64(1, UINT64_MAX);  // distribution in range [1, UINT64_MAX]
+        /**
+         * Number of fork() done by the process, as seen by the child.
+         * Per thread state derived from random numbers must be rebuilt when
+         * it changes.
+         */
+        static uint64_t getForkGeneration() {
+            return forkGeneration().load(std::memory_order_relaxed);
+        }
+
+    private:
+        /**
+         * Engine of one thread, with the fork generation it was seeded in.
+         */
+        struct State {
+            std::mt19937_64 rng;
+            uint64_t generation = 0;
+            bool seeded = false;
+        };
+
+        /**
+         * Number of fork() done by the process, as seen by the child.
+         */
+        static std::atomic<uint64_t> &forkGeneration() {
+            static std::atomic<uint64_t> generation{0};
+            static const bool registered = (0 == pthread_atfork(nullptr, nullptr, [] {
+                generation.fetch_add(1, std::memory_order_relaxed);
+            }));
+            (void)registered;
+            return generation;
+        }
 
-            return dist_64(rng);
+        /**
+         * @return the engine of the calling thread, seeded for the current process.
+         */
+        static std::mt19937_64 &engine() {
+            static thread_local State state;
+            auto generation = forkGeneration().load(std::memory_order_relaxed);
+            if (!state.seeded || state.generation != generation) {
+                std::random_device dev;
+                std::array<std::random_device::result_type, 8> seed{};
+                std::generate(seed.begin(), seed.end(), std::ref(dev));
+                std::seed_seq seq(seed.begin(), seed.end());
+                state.rng.seed(seq);
+                state.generation = generation;
+                state.seeded = true;
+            }
+            return state.rng;
         }
 };
 
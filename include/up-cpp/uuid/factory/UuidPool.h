@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _UUID_POOL_H_
+#define _UUID_POOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <up-cpp/uuid/datamodel/RawUuid.h>
+#include <up-core-api/uuid.pb.h>
+
+namespace uprotocol::uuid {
+using namespace uprotocol::v1;
+
+/**
+ * Pool of UUIDs pre-generated by Uuidv8Factory for latency critical senders.
+ * A background thread keeps a lock-free single producer / single consumer ring
+ * topped up, so take() only has to read the next slot. When the ring runs dry,
+ * take() falls back to generating the UUID inline.
+ *
+ * take() must always be called from the same thread; senders running on
+ * several threads use one pool each. The UUIDs it returns are increasing:
+ * pre-generated UUIDs older than one generated inline are dropped.
+ * So that unix_ts_ms stays meaningful after the sender was idle, the
+ * background thread expires pre-generated UUIDs older than a maximum age and
+ * regenerates them, without take() reading the clock.
+ */
+class UuidPool {
+public:
+    /** Default number of pre-generated UUIDs */
+    static constexpr std::size_t DefaultCapacity = 1024;
+
+    /** Default period of the background thread */
+    static constexpr std::chrono::microseconds DefaultRefillInterval{100};
+
+    /** Default maximum age of a pre-generated UUID */
+    static constexpr std::chrono::milliseconds DefaultMaxAge{100};
+
+    /**
+     * Starts the background thread.
+     * @param capacity Number of pre-generated UUIDs, rounded up to a power of 2.
+     * @param refillInterval Period at which the background thread tops up the ring.
+     * @param maxAge Pre-generated UUIDs whose unix_ts_ms is older than the
+     * current time of Uuidv8Factory by more than maxAge are expired by the
+     * background thread, at most one refillInterval late. Each expiry
+     * regenerates up to capacity UUIDs, so a short maxAge uses up counter
+     * space of Uuidv8Factory that other senders share.
+     */
+    explicit UuidPool(std::size_t capacity = DefaultCapacity,
+                      std::chrono::microseconds refillInterval = DefaultRefillInterval,
+                      std::chrono::milliseconds maxAge = DefaultMaxAge);
+
+    /**
+     * Stops the background thread.
+     */
+    ~UuidPool();
+
+    UuidPool(const UuidPool &) = delete;
+    UuidPool &operator=(const UuidPool &) = delete;
+
+    /**
+     * @return the next UUID.
+     */
+    RawUuid take();
+
+    /**
+     * @return the next UUID as a protobuf UUID.
+     */
+    UUID takeUUID();
+
+    /**
+     * @return the number of take() that found the ring empty.
+     */
+    uint64_t dryCount() const { return dryCount_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return the number of pre-generated UUIDs dropped because they were
+     * older than a UUID generated inline.
+     */
+    uint64_t droppedCount() const { return droppedCount_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return the number of pre-generated UUIDs expired by the background
+     * thread because they were older than the maximum age.
+     */
+    uint64_t expiredCount() const { return expiredCount_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return the size of the ring.
+     */
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    /**
+     * Background thread: tops up the ring until the pool is destroyed.
+     */
+    void refill(std::chrono::microseconds refillInterval);
+
+    /**
+     * Background thread: moves skip_ past the unread UUIDs older than the
+     * maximum age.
+     * @return the first slot take() may read.
+     */
+    std::size_t expire(std::size_t head, std::size_t tail);
+
+    /**
+     * Slot of the ring. The background thread may overwrite an expired slot
+     * while take() copies it, so both halves are atomics.
+     */
+    struct Slot {
+        std::atomic<uint64_t> msb{0};
+        std::atomic<uint64_t> lsb{0};
+    };
+
+    /** Ring size - 1, the size being a power of 2 */
+    std::size_t mask_;
+
+    /** Maximum age of a pre-generated UUID, in milliseconds */
+    uint64_t maxAge_;
+
+    /** The ring */
+    std::unique_ptr<Slot[]> ring_;
+
+    /** UUIDs generated by the background thread before they are copied to the ring */
+    std::unique_ptr<RawUuid[]> batch_;
+
+    /** Next slot read by take(), only written by the consumer */
+    alignas(64) std::atomic<std::size_t> head_{0};
+
+    /** Next slot written by the background thread, only written by the producer */
+    alignas(64) std::atomic<std::size_t> tail_{0};
+
+    /**
+     * Slots before skip_ expired, only written by the producer. take() moves
+     * head_ up to it, and the producer may overwrite the slots before it.
+     */
+    std::atomic<std::size_t> skip_{0};
+
+    /** Last UUID returned by take() */
+    alignas(64) uint64_t lastMsb_ = 0;
+
+    /** Number of take() that found the ring empty */
+    std::atomic<uint64_t> dryCount_{0};
+
+    /** Number of dropped pre-generated UUIDs */
+    std::atomic<uint64_t> droppedCount_{0};
+
+    /** Number of expired pre-generated UUIDs */
+    std::atomic<uint64_t> expiredCount_{0};
+
+    /** Cleared to stop the background thread */
+    std::atomic<bool> running_{true};
+
+    /** Wakes the background thread up when the pool is destroyed */
+    std::mutex stopMutex_;
+    std::condition_variable stopCondition_;
+
+    /** The background thread */
+    std::thread thread_;
+
+}; // class UuidPool
+
+} // namespace uprotocol::uuid
+
+#endif // _UUID_POOL_H_
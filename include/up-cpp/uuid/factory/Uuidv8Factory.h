@@ -25,8 +25,11 @@
 #ifndef _UUID_V8_FACTORY_H_
 #define _UUID_V8_FACTORY_H_
 
+#include <atomic>
+#include <cstddef>
 #include "RandomGen.h"
 #include "UuidFactory.h"
+#include <up-cpp/uuid/datamodel/RawUuid.h>
 #include <up-core-api/uuid.pb.h>
 
 namespace uprotocol::uuid {
@@ -63,11 +66,179 @@ namespace uprotocol::uuid {
 * */
 class Uuidv8Factory : public UuidFactory {
 public:
+    /**
+     * How the counter and rand_b state is shared between threads.
+     */
+    enum class Mode : uint8_t {
+        /**
+         * One counter and one rand_b for the whole process, updated atomically.
+         * Ids are unique and increasing across all the threads.
+         */
+        Shared,
+        /**
+         * Each thread has its own counter and its own random rand_b, so
+         * generation does not touch any shared state. Ids are increasing within
+         * each thread, and unique across threads thanks to their rand_b.
+         * A forked child draws a new rand_b instead of replaying the ids of
+         * the thread it was forked from.
+         */
+        ThreadLocal
+    };
+
+    /**
+     * What to do when the 12 bit counter of the current millisecond tick
+     * is exhausted, i.e. more than 4096 ids are generated within 1ms.
+     */
+    enum class Overflow : uint8_t {
+        /**
+         * Wait for the clock to move to the next tick. unix_ts_ms stays
+         * accurate, but generation is limited to 4096 ids per millisecond.
+         * Only the current tick is waited for: when the clock is behind the
+         * last id, e.g. after being stepped back or after Borrow, the next
+         * tick is borrowed instead, so that generation never stalls.
+         */
+        Wait,
+        /**
+         * Borrow the next millisecond tick without waiting for the clock.
+         * Generation is not limited, but under sustained load unix_ts_ms runs
+         * ahead of the clock until the load drops.
+         */
+        Borrow
+    };
+
+    /**
+     * Source of unix_ts_ms.
+     */
+    enum class Clock : uint8_t {
+        /**
+         * CLOCK_REALTIME, through std::chrono::system_clock. The default, as
+         * unix_ts_ms is the Unix epoch. Unlike a monotonic clock it can be
+         * stepped back by NTP or an RTC update: ids keep increasing by
+         * borrowing ticks until the clock catches up, see Overflow::Wait.
+         */
+        Realtime,
+        /**
+         * CLOCK_REALTIME_COARSE: cheaper to read than Realtime, but it only
+         * moves at the kernel tick, typically every 1 to 4ms. Fewer ticks
+         * means the counter overflows sooner under load.
+         */
+        RealtimeCoarse,
+        /**
+         * Millisecond tick cached by a helper thread, so reading the clock is
+         * a single atomic load. The helper thread runs while this clock is
+         * selected, and is restarted in a forked child on first use.
+         */
+        Cached,
+        /**
+         * Time set by setManualTime(), for tests and deterministic benchmarks.
+         * With Overflow::Wait, an exhausted counter of the current tick waits
+         * until the time is set to a later tick.
+         */
+        Manual
+    };
+
+    /**
+     * Selects the source of unix_ts_ms.
+     * @param clock Clock source, Clock::Realtime by default.
+     */
+    static void setClock(Clock clock);
+
+    /**
+     * @return the source of unix_ts_ms.
+     */
+    static Clock getClock() { return clock_.load(std::memory_order_relaxed); }
+
+    /**
+     * Sets the time of Clock::Manual.
+     * @param ms Unix time in milliseconds.
+     */
+    static void setManualTime(uint64_t ms) { manualTime_.store(ms, std::memory_order_relaxed); }
+
+    /**
+     * @return the current Unix time in milliseconds of the selected clock.
+     */
+    static uint64_t now();
+
+    /**
+     * Selects the counter overflow strategy.
+     * @param overflow Overflow strategy, Overflow::Wait by default.
+     */
+    static void setOverflow(Overflow overflow) { overflow_.store(overflow, std::memory_order_relaxed); }
+
+    /**
+     * @return the counter overflow strategy.
+     */
+    static Overflow getOverflow() { return overflow_.load(std::memory_order_relaxed); }
+
+    /**
+     * Selects the generator mode used by create() and createBatch().
+     * @param mode Generator mode, Mode::Shared by default.
+     */
+    static void setMode(Mode mode) { mode_.store(mode, std::memory_order_relaxed); }
+
+    /**
+     * @return the generator mode used by create() and createBatch().
+     */
+    static Mode getMode() { return mode_.load(std::memory_order_relaxed); }
+
     /** factory function that generates the UUID */
     static UUID create();
+
+    /**
+     * Generates a burst of UUIDs. In Mode::Shared a range of the counter is
+     * reserved with a single atomic operation per millisecond tick, and the
+     * ids are increasing also across threads. In Mode::ThreadLocal the ids are
+     * increasing within the calling thread. When the counter of the current
+     * tick is exhausted, the Overflow strategy applies.
+     * @param count Number of UUIDs to generate.
+     * @param[out] ids Array of at least count elements that receives the UUIDs.
+     */
+    static void createBatch(std::size_t count, RawUuid *ids);
+
+    /**
+     * Builds the protobuf UUID of a generated id.
+     * @param id Raw UUID.
+     * @return UUID object
+     */
+    static UUID toUUID(const RawUuid &id);
+
 private:
-    /** Retrieves the past UUID's MSB part    */
-    static uint64_t getLastMsb() { return lastMsb_; }
+    /**
+     * Generator state of one thread in Mode::ThreadLocal.
+     */
+    struct ThreadState {
+        /** Last generated msb of the thread */
+        uint64_t lastMsb = 0;
+        /** LSB part of the UUIDs of the thread */
+        uint64_t lsb = (RandomGenerator::GenerateRandom() & randomMask_) | variant_;
+        /** Fork generation lsb was drawn in */
+        uint64_t forkGeneration = RandomGenerator::getForkGeneration();
+    };
+
+    /**
+     * Computes the first MSB following prevMsb at the current time.
+     * @param prevMsb Last generated MSB.
+     * @param[out] msb Next MSB.
+     * @return false if the counter of the current tick is exhausted and
+     * the Overflow strategy is to wait. Never false when the clock is behind
+     * the tick of prevMsb.
+     */
+    static bool nextMsb(uint64_t prevMsb, uint64_t &msb);
+
+    /**
+     * Reserves up to count consecutive MSBs in the current millisecond tick.
+     * @param count Number of MSBs wanted.
+     * @param[out] first First reserved MSB.
+     * @return Number of reserved MSBs, between 1 and count.
+     */
+    static uint64_t reserve(uint64_t count, uint64_t &first);
+
+    /**
+     * Mode::ThreadLocal equivalent of createBatch.
+     * @param count Number of UUIDs to generate.
+     * @param[out] ids Array of at least count elements that receives the UUIDs.
+     */
+    static void createThreadLocalBatch(std::size_t count, RawUuid *ids);
 
     /** Represents allowable clock drift tolerance    */
     static constexpr uint64_t clockDriftTolerance_ = 10000000;
@@ -85,19 +256,28 @@ private:
     static constexpr uint64_t maxCount_ = 0xfff;
 
     /* Using atomic, so we need not implment locking
-    *  lastMsb_ to maintain the previous values of msb
+    *  lastMsb_ to maintain the last reserved value of msb
     *  so that they help in tracking the past UUID's time and count.
     *  It will be shared across all UUID instanaces
     */
     static inline std::atomic<uint64_t> lastMsb_;
 
-    /** Represents MSB part of UUID */
-    static inline uint64_t msb_;
-
     /** Represents LSB part of UUID */
     static inline uint64_t lsb_ = (RandomGenerator::GenerateRandom()
                                    & randomMask_) | variant_;
 
+    /** Generator mode */
+    static inline std::atomic<Mode> mode_{Mode::Shared};
+
+    /** Counter overflow strategy */
+    static inline std::atomic<Overflow> overflow_{Overflow::Wait};
+
+    /** Source of unix_ts_ms */
+    static inline std::atomic<Clock> clock_{Clock::Realtime};
+
+    /** Time of Clock::Manual */
+    static inline std::atomic<uint64_t> manualTime_{0};
+
 }; // class UUIDv8Factory
 
 } //namespace  uprotocol::uuid
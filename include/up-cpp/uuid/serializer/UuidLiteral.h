@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _UUID_LITERAL_H_
+#define _UUID_LITERAL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <up-cpp/uuid/datamodel/RawUuid.h>
+
+namespace uprotocol::uuid {
+
+/**
+ * Parses a canonical UUID string "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx",
+ * upper or lower case, at compile time or at run time. The result is the
+ * same as UuidSerializer::deserializeFromString.
+ * @param str The UUID string.
+ * @param uuid Set to the parsed UUID, only if the string is valid.
+ * @return false if the string is not a canonical UUID.
+ */
+constexpr bool parseUuid(std::string_view str, RawUuid &uuid) noexcept {
+    if (36 != str.size()) {
+        return false;
+    }
+    uint64_t halves[2] = {0, 0};
+    std::size_t digits = 0;
+    for (std::size_t pos = 0; pos < str.size(); ++pos) {
+        auto ch = str[pos];
+        if (8 == pos || 13 == pos || 18 == pos || 23 == pos) {
+            if ('-' != ch) {
+                return false;
+            }
+            continue;
+        }
+        uint64_t nibble = 0;
+        if (ch >= '0' && ch <= '9') {
+            nibble = ch - '0';
+        } else if (ch >= 'a' && ch <= 'f') {
+            nibble = ch - 'a' + 10;
+        } else if (ch >= 'A' && ch <= 'F') {
+            nibble = ch - 'A' + 10;
+        } else {
+            return false;
+        }
+        // same layout as UuidSerializer: bytes of each half, least significant first
+        auto shift = 8 * ((digits / 2) % 8) + ((digits % 2) ? 0 : 4);
+        halves[digits / 16] |= nibble << shift;
+        ++digits;
+    }
+    uuid = RawUuid{halves[0], halves[1]};
+    return true;
+}
+
+/**
+ * Parses a canonical UUID string. Meant for constant expressions, where an
+ * invalid string is a compile error:
+ *     static constexpr RawUuid id = parseUuid("0080b636-8303-8701-8ebe-7a9a9e767a9f");
+ * @param str The UUID string.
+ * @return the parsed UUID.
+ * @throws std::invalid_argument if the string is not a canonical UUID,
+ * when evaluated at run time.
+ */
+constexpr RawUuid parseUuid(std::string_view str) {
+    RawUuid uuid{0, 0};
+    if (!parseUuid(str, uuid)) {
+        throw std::invalid_argument("invalid UUID literal");
+    }
+    return uuid;
+}
+
+namespace literals {
+
+/**
+ * UUID literal: "0080b636-8303-8701-8ebe-7a9a9e767a9f"_uuid.
+ * Used to initialize a constexpr variable, an invalid literal is a compile error.
+ */
+constexpr RawUuid operator""_uuid(const char *str, std::size_t len) {
+    return parseUuid(std::string_view(str, len));
+}
+
+} // namespace literals
+
+} // namespace uprotocol::uuid
+
+#endif // _UUID_LITERAL_H_
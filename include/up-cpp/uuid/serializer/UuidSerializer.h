@@ -25,6 +25,12 @@
 #ifndef _UUID_SERIALIZER_H_
 #define _UUID_SERIALIZER_H_
 
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <up-cpp/uuid/datamodel/RawUuid.h>
 #include <up-core-api/uuid.pb.h>
 #include <spdlog/spdlog.h>
 
@@ -38,6 +44,11 @@ using namespace uprotocol::v1;
 */
 class UuidSerializer {
     public:
+        /** Number of characters of a UUID in String format */
+        static constexpr std::size_t StringLength = 36;
+
+        /** Number of bytes of a UUID in byte stream format */
+        static constexpr std::size_t BytesLength = 16;
  
         /**
         * @brief Support for serializing UUID objects into their String format.
@@ -46,6 +57,22 @@ class UuidSerializer {
         */
         static std::string serializeToString(UUID uuid);
 
+        /**
+        * @brief Serializes a UUID into its String format, without allocating.
+        * @param uuid UUID object to be serialized to the String format.
+        * @param[out] out Receives the String format, not null terminated.
+        */
+        static void serializeToString(const UUID &uuid,
+                                      char (&out)[StringLength]);
+
+        /**
+        * @brief Serializes a raw UUID into its String format, without allocating.
+        * @param uuid Raw UUID to be serialized to the String format.
+        * @param[out] out Receives the String format, not null terminated.
+        */
+        static void serializeToString(const RawUuid &uuid,
+                                      char (&out)[StringLength]);
+
         /**
         *
         * @brief Support for serializing UUID objects into their Byte stream.
@@ -56,11 +83,29 @@ class UuidSerializer {
         static std::vector<uint8_t> serializeToBytes(UUID uuid);
 
         /**
-        * @brief Deserialize a String into a UUID object.
+        * @brief Serializes a UUID into its byte stream, without allocating.
+        * @param uuid UUID object to be serialized to the byte array format.
+        * @param[out] out Receives the byte stream.
+        */
+        static void serializeToBytes(const UUID &uuid,
+                                     std::array<uint8_t, BytesLength> &out);
+
+        /**
+        * @brief Deserialize a String into a UUID object, without copying it.
         * @param uuid String equivalent UUID
         * @return Returns an UUID data object.
         */
-        static UUID deserializeFromString(std::string uuidStr);
+        static UUID deserializeFromString(std::string_view uuidStr);
+
+        /**
+        * @brief Deserialize a String into a raw UUID, without allocating.
+        * '-' are ignored and missing hex digits are taken as 0.
+        * @param uuidStr String equivalent UUID
+        * @param[out] uuid Receives the UUID.
+        * @return false if the String has invalid characters or more than 32 hex digits.
+        */
+        static bool deserializeFromString(std::string_view uuidStr,
+                                          RawUuid &uuid);
 
         /**
         * @brief Deserialize a byte stream into a UUID object.
@@ -69,19 +114,89 @@ class UuidSerializer {
         */
         static UUID deserializeFromBytes(std::vector<uint8_t> bytes);
 
+        /**
+        * @brief Deserialize a byte stream into a UUID object, without allocating.
+        * @param bytes UUID represented in byte stream equivalent
+        * @return Returns an UUID data object.
+        */
+        static UUID deserializeFromBytes(const std::array<uint8_t, BytesLength> &bytes);
+
+        /**
+        * Implementations of the bulk String conversions.
+        */
+        enum class HexKernel : uint8_t {
+            /** Portable implementation */
+            Scalar,
+            /** x86 SSE4.1 implementation */
+            Sse41,
+            /** x86 AVX2 implementation */
+            Avx2
+        };
+
+        /**
+        * @brief Selects the implementation of serializeToStrings and deserializeFromStrings.
+        * By default the best one supported by the CPU is used.
+        * @param kernel Implementation to use.
+        * @return false if the CPU does not support it. The selection is then unchanged.
+        */
+        static bool setHexKernel(HexKernel kernel);
+
+        /**
+        * @return the implementation of serializeToStrings and deserializeFromStrings.
+        */
+        static HexKernel getHexKernel();
+
+        /**
+        * @brief Serializes UUIDs into their String format, stored back to back
+        * without separator nor null terminator. Same output as serializeToString.
+        * @param uuids Array of count raw UUIDs.
+        * @param count Number of UUIDs.
+        * @param[out] out Array of count * StringLength characters.
+        */
+        static void serializeToStrings(const RawUuid *uuids,
+                                       std::size_t count,
+                                       char *out);
+
+        /**
+        * @brief Deserializes canonical UUID Strings ("xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx")
+        * stored back to back, StringLength characters each. Strings that are not
+        * canonical are deserialized as {0, 0}.
+        * @param in Array of count * StringLength characters.
+        * @param count Number of UUIDs.
+        * @param[out] uuids Array of count raw UUIDs.
+        * @return Number of valid Strings.
+        */
+        static std::size_t deserializeFromStrings(const char *in,
+                                                  std::size_t count,
+                                                  RawUuid *uuids);
+
         /**
         * @brief extracts UTC time at from current UUID object
         * @param uuid UUID object
         * @return UTC time
         */
-        static uint64_t getTime(UUID uuid) { return uuid.msb() >> 16; }
+        static uint64_t getTime(const UUID &uuid) { return uuid.msb() >> 16; }
 
         /**
         * @brief return current count of UUID numbers generated
         * @param uuid UUID object
         * @return count
         */
-        static uint64_t getCount(UUID uuid) { return (uuid.msb() & 0xFFFL); }
+        static uint64_t getCount(const UUID &uuid) { return (uuid.msb() & 0xFFFL); }
+
+        /**
+        * @brief extracts UTC time at from a raw UUID
+        * @param uuid raw UUID
+        * @return UTC time
+        */
+        static constexpr uint64_t getTime(const RawUuid &uuid) { return uuid.getTime(); }
+
+        /**
+        * @brief return count of UUID numbers generated in the same millisecond
+        * @param uuid raw UUID
+        * @return count
+        */
+        static constexpr uint64_t getCount(const RawUuid &uuid) { return uuid.getCount(); }
 
     private:
         UuidSerializer() = default;
@@ -96,16 +211,24 @@ class UuidSerializer {
                             uint64_t lsb);
 
         /**
-        * @brief takes uuid in the string form and writes it to uuidOut
-        * @param str uuid in string
-        * @param[out]  uuidOut  uuid is stored in vector of size 16
-        * @return int - failure status
+        * @brief Writes msb and lsb to a byte stream, least significant bytes first
+        * @param msb 64 bit MSB part of UUID
+        * @param lsb 64 bit LSB part of UUID
+        * @param[out] out byte stream of size 16
+        */
+        static void toBytes(uint64_t msb,
+                            uint64_t lsb,
+                            uint8_t *out);
+
+        /**
+        * @brief Reads msb and lsb from a byte stream written by toBytes
+        * @param bytes byte stream of size 16
+        * @return the raw UUID
         */
-        static int uuidFromString(std::string str,
-                                  std::vector<uint8_t> &uuidOut);
+        static RawUuid fromBytes(const uint8_t *bytes);
 
         /** UUID array size */
-        static constexpr int uuidSize_ = 16;
+        static constexpr int uuidSize_ = BytesLength;
 
 }; // UuidSerializer
 
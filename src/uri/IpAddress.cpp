@@ -24,52 +24,158 @@
  */
 
 #include <array>
+#include <cstring>
+#include <functional>
 #include <arpa/inet.h>
 #include <spdlog/spdlog.h>
 #include <up-cpp/uri/serializer/IpAddress.h>
 
 using namespace uprotocol::uri;
 
+namespace {
+
+/**
+ * Number of IPv6 addresses IpAddress::normalize remembers, per thread.
+ */
+constexpr std::size_t NormalizeCacheSize = 64;
+
+/**
+ * Parse dotted decimal IPv4, accepting exactly what inet_pton(AF_INET) does:
+ * 4 decimal octets up to 255, without leading zeros.
+ */
+auto parseIpV4(std::string_view text, uint8_t* bytes) -> bool {
+    std::size_t pos = 0;
+    for (auto octet = 0; octet < IpAddress::IpV4AddressBytes; ++octet) {
+        if (octet > 0) {
+            if (pos >= text.size() || '.' != text[pos]) {
+                return false;
+            }
+            ++pos;
+        }
+        unsigned value = 0;
+        std::size_t digits = 0;
+        for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos, ++digits) {
+            if (1 == digits && 0 == value) {
+                return false;
+            }
+            value = value * 10 + (text[pos] - '0');
+            if (value > 255) {
+                return false;
+            }
+        }
+        if (0 == digits) {
+            return false;
+        }
+        bytes[octet] = static_cast<uint8_t>(value);
+    }
+    return pos == text.size();
+}
+
+/**
+ * Parse IPv6 with inet_pton, from a null terminated copy on the stack.
+ */
+auto parseIpV6(std::string_view text, uint8_t* bytes) -> bool {
+    std::array<char, INET6_ADDRSTRLEN> terminated{};
+    if (text.size() >= terminated.size()) {
+        return false;
+    }
+    std::memcpy(terminated.data(), text.data(), text.size());
+    return 1 == inet_pton(AF_INET6, terminated.data(), bytes);
+}
+
+} // namespace
+
 /**
  * Updates the byte format of IP address and type, from the string format.
  */
-void IpAddress::toBytes() {
-    std::array<uint8_t, IpAddress::IpV6AddressBytes> bytes = {0};
-    auto length = 0;
-    if (ipString_.empty()) {
+void IpAddress::toBytes(std::string_view ipString) {
+    if (ipString.empty()) {
         type_ = AddressType::Local;
-    } else if (1 == inet_pton(AF_INET, ipString_.c_str(), &bytes)) {
+    } else if (parseIpV4(ipString, ipBytes_.data())) {
         type_ = AddressType::IpV4;
-        length = IpAddress::IpV4AddressBytes;
-    } else if (1 == inet_pton(AF_INET6, ipString_.c_str(), &bytes)) {
+        length_ = IpAddress::IpV4AddressBytes;
+    } else if (parseIpV6(ipString, ipBytes_.data())) {
         type_ = AddressType::IpV6;
-        length = IpAddress::IpV6AddressBytes;
+        length_ = IpAddress::IpV6AddressBytes;
     } else {
         type_ = AddressType::Invalid;
     }
+}
 
-    for (auto i = 0; i < length; i++) {
-        this->ipBytes_.push_back(bytes[i]);
+IpAddress::IpAddress(const uint8_t* ipBytes, std::size_t size, AddressType type) {
+    const std::size_t length = (AddressType::IpV4 == type) ? IpV4AddressBytes
+                             : (AddressType::IpV6 == type) ? IpV6AddressBytes
+                             : 0;
+    if (0 == length || nullptr == ipBytes || size < length) {
+        spdlog::error("ipBytes do not hold an IPv4 or IPv6 address");
+        return;
     }
+    type_ = type;
+    length_ = static_cast<uint8_t>(length);
+    std::memcpy(ipBytes_.data(), ipBytes, length);
+}
+
+void IpAddress::setText(std::string_view ipString) {
+    hasText_ = true;
+    if (ipString.size() > MaxTextLength) {
+        longText_.assign(ipString);
+        return;
+    }
+    std::memcpy(text_.data(), ipString.data(), ipString.size());
+    textLength_ = static_cast<uint8_t>(ipString.size());
+}
+
+auto IpAddress::getString() const -> std::string {
+    if (!hasText_) {
+        return normalized();
+    }
+    if (!longText_.empty()) {
+        return longText_;
+    }
+    return std::string(text_.data(), textLength_);
 }
 
 /**
- * Updates the string format of IP address.
+ * Formats the string format of IP address.
  */
-void IpAddress::toString() {
-    if (!ipBytes_.empty()) {
-         
-        char ip_char[INET6_ADDRSTRLEN + 1];
-        
-        auto inet_type = (type_ == AddressType::IpV4) ? AF_INET : AF_INET6;
+auto IpAddress::normalized() const -> std::string {
+    if (0 == length_) {
+        return {};
+    }
+    std::array<char, INET6_ADDRSTRLEN> ip_char{};
+    auto inet_type = (type_ == AddressType::IpV4) ? AF_INET : AF_INET6;
+    if (inet_ntop(inet_type, ipBytes_.data(), ip_char.data(), ip_char.size()) == nullptr) {
+        spdlog::error("inet_ntop failed");
+        return {};
+    }
+    return ip_char.data();
+}
 
-        if (inet_ntop(inet_type, ipBytes_.data(), ip_char, INET6_ADDRSTRLEN) == nullptr) {
-            spdlog::error("inet_ntop failed");
-        }
-        else {
-            ipString_ = ip_char;
-        }
-    } else {
-        spdlog::error("ipBytes is empty");
+auto IpAddress::normalize(std::string_view address, std::string& normalized) -> AddressType {
+    std::array<uint8_t, IpV4AddressBytes> ipv4{};
+    if (parseIpV4(address, ipv4.data())) {
+        // inet_ntop prints the same dotted decimal, there are no leading zeros to drop
+        normalized.assign(address);
+        return AddressType::IpV4;
+    }
+
+    struct CacheEntry {
+        std::string address;
+        std::string normalized;
+    };
+    thread_local std::array<CacheEntry, NormalizeCacheSize> cache;
+    auto& entry = cache[std::hash<std::string_view>{}(address) % NormalizeCacheSize];
+    if (!entry.address.empty() && entry.address == address) {
+        normalized = entry.normalized;
+        return AddressType::IpV6;
+    }
+
+    IpAddress ip(address);
+    if (AddressType::IpV6 != ip.getType()) {
+        return AddressType::Invalid;
     }
+    normalized = ip.normalized();
+    entry.address.assign(address);
+    entry.normalized = normalized;
+    return AddressType::IpV6;
 }
@@ -23,7 +23,6 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <regex>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -33,6 +32,23 @@
 #include <up-cpp/uri/builder/BuildUResource.h>
 #include <up-cpp/uri/tools/Utils.h>
 #include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include "LongUriWriter.h"
+
+namespace uprotocol::uri {
+namespace {
+
+using namespace longform;
+
+template <typename Buffer>
+auto writeUriTo(Buffer& out, const v1::UUri& uri) -> void {
+    out.clear();
+    out.reserve(LongUriSerializer::serializedLength(uri));
+    BufferSink<Buffer> sink(out);
+    writeUri(sink, uri);
+}
+
+} // namespace
+} // namespace uprotocol::uri
 
 /**
  * Support for serializing UUri objects into their String format.
@@ -41,130 +57,86 @@
  * in a uProtocol publish communication.
  */ 
 auto uprotocol::uri::LongUriSerializer::serialize(const v1::UUri& uri) -> std::string {
-    if (isEmpty(uri)) {
-        return "";
-    }
-
     std::string uri_string;
-    uri_string.append(buildAuthorityPartOfUri(uri.authority()));
-    if (uri_string.length() >= 2 || uri_string.empty()) {
-        uri_string.append("/");
-    }
-    if (isEmpty(uri.entity())) {
-        return uri_string;
-    }
-    uri_string.append(buildSoftwareEntityPartOfUri(uri.entity()));
-    uri_string.append(buildResourcePartOfUri(uri.resource()));
-
+    serialize(uri, uri_string);
     return uri_string;
 }
 
+/**
+ * Serialize a UUri into a caller supplied string, replacing its content.
+ * @param uri UUri object to be serialized to the String format.
+ * @param out Receives the String format of the supplied UUri.
+ */
+auto uprotocol::uri::LongUriSerializer::serialize(const v1::UUri& uri, std::string& out) -> void {
+    writeUriTo(out, uri);
+}
+
+/**
+ * Serialize a UUri into a caller supplied fmt buffer, replacing its content.
+ * @param uri UUri object to be serialized to the String format.
+ * @param out Receives the String format of the supplied UUri.
+ */
+auto uprotocol::uri::LongUriSerializer::serialize(const v1::UUri& uri, fmt::memory_buffer& out) -> void {
+    writeUriTo(out, uri);
+}
+
+/**
+ * Number of characters of the String format of a UUri.
+ * @param uri UUri object.
+ * @return Returns the length of serialize(uri).
+ */
+auto uprotocol::uri::LongUriSerializer::serializedLength(const v1::UUri& uri) -> std::size_t {
+    LengthSink sink;
+    writeUri(sink, uri);
+    return sink.length();
+}
+
+/**
+ * Deserialize a String into a UUri object.
+ * @param protocol_uri A long format uProtocol URI.
+ * @return Returns an UUri data object.
+ */
+auto uprotocol::uri::LongUriSerializer::deserialize(const std::string& protocol_uri) -> v1::UUri {
+    return deserialize(std::string_view(protocol_uri));
+}
+
 /**
  * Deserialize a String into a UUri object.
  * @param protocol_uri A long format uProtocol URI.
  * @return Returns an UUri data object.
  */
-auto uprotocol::uri::LongUriSerializer::deserialize(std::string const& protocol_uri) -> v1::UUri {
+auto uprotocol::uri::LongUriSerializer::deserialize(std::string_view protocol_uri) -> v1::UUri {
     if (protocol_uri.empty()) {
         return BuildUUri().build();
     }
 
-    auto uri = protocol_uri;
-    std::replace(uri.begin(), uri.end(), '\\', '/');
-    
-     const auto uri_parts = split(uri, "/");
+    const UriTokenizer uri_parts(protocol_uri);
 
     constexpr auto MinimumParts = 2;
     
-    if (auto j = getFirstNotEmpty(uri_parts); j > 3) {
+    if (uri_parts.firstNotEmpty() > 3) {
         return BuildUUri().build();
     }
     
-    //bool is_local = isLocality(uri);
     if (uri_parts.size() < MinimumParts) {
         return BuildUUri().build();
-    } else if (isLocality(uri)) {
+    } else if (uri_parts.isLocal()) {
         return parseLocalUUri(uri_parts);
     } else {
         return parseRemoteUUri(uri_parts);
     }
 }
 
-/**
- * Check the number of empty strings in the Vector from the start to find the first non-empty string.
- * THis is used to determine if the URI is local or remote.
- * @param uri_parts 
- * @return 
- */
-auto uprotocol::uri::LongUriSerializer::getFirstNotEmpty(const std::vector<std::string> &uri_parts) -> uint64_t {
-    decltype(uri_parts.size()) j = 0;
-    for (const auto & uri_part : uri_parts) {
-        if (uri_part.empty()) {
-            ++j;
-        } else {
-            break;
-        }
-    }
-    return j;
-}
-
-/**
- * Find if the URI string is local or remote
- * @param uri 
- * @return 
- */
-auto inline uprotocol::uri::LongUriSerializer::isLocality(const std::string_view &uri) -> bool {
-    auto pos = uri.find("//");
-    auto is_local = pos != 0;  // local if does not start with "//"
-    if (!is_local) { // we find that is remote since "//" is found
-        is_local = uri.find("///", pos) == 0;  // local if starts with "///");
-    }
-    return is_local;
-}
-
-/**
- * Splits this string around matches of the given string delimiter.
- * Trailing empty strings are therefore not included in the resulting array.
- * @param str String to be split.
- * @param delimiter Delimiter to split the string.
- * @return Returns a vector of strings.
- */
-auto uprotocol::uri::LongUriSerializer::split(std::string str,
-                              const std::string_view& delimiter) -> std::vector<std::string> {
-    std::vector<std::string> vec;
-    std::string token;
-    auto pos = str.find(delimiter);
-    while (std::string::npos != pos) {
-        token = str.substr(0, pos);
-        vec.push_back(token);
-        str.erase(0, pos + delimiter.length());
-        pos = str.find(delimiter);
-    }
-    vec.push_back(str);
-
-    return vec;
-}
-
 /**
  * Create the resource part of the Uri from a resource object.
  * @param uResource  Resource representing a resource or an RPC method.
  * @return Returns the String representation of the  Resource in the uProtocol URI.
  */
 auto uprotocol::uri::LongUriSerializer::buildResourcePartOfUri(const v1::UResource& resource) -> std::string {
-    if (isEmpty(resource)) {
-        return "";
-    }
-
-    std::string sb("/");
-    sb.append(resource.name());
-    if (resource.has_instance() && !resource.instance().empty()) {
-        sb.append(".").append(resource.instance());
-    }
-    if (resource.has_message() && !resource.message().empty()) {
-        sb.append("#").append(resource.message());
-    }
-
-    return sb;
+    std::string part;
+    BufferSink<std::string> sink(part);
+    writeResource(sink, resource);
+    return part;
 }
 
 /**
@@ -173,20 +145,10 @@ auto uprotocol::uri::LongUriSerializer::buildResourcePartOfUri(const v1::UResour
  * @return Returns the String representation of the  Software Entity in the uProtocol URI.
  */
 auto uprotocol::uri::LongUriSerializer::buildSoftwareEntityPartOfUri(const v1::UEntity& entity) -> std::string {
-    if (isEmpty(entity)) {
-        return "";
-    }
-    
-    std::string sb = trim_copy(entity.name());
-    sb.append("/");
-    if (entity.has_version_major() && entity.has_version_minor())   {
-        sb.append(std::to_string(entity.version_major()));
-        sb.append(".");
-        sb.append(std::to_string(entity.version_minor()));
-    } else if (entity.has_version_major()) {
-        sb.append(std::to_string(entity.version_major()));
-    }
-    return sb;
+    std::string part;
+    BufferSink<std::string> sink(part);
+    writeEntity(sink, entity);
+    return part;
 }
 
 /**
@@ -195,16 +157,10 @@ auto uprotocol::uri::LongUriSerializer::buildSoftwareEntityPartOfUri(const v1::U
  * @return Returns the string representation of Authority.
  */
 auto uprotocol::uri::LongUriSerializer::buildAuthorityPartOfUri(const v1::UAuthority& u_authority) -> std::string {
-    std::string authority;
-    if (isEmpty(u_authority)) {
-        authority = "/";
-    } else {
-        if (u_authority.has_name() && !u_authority.name().empty()) {
-            authority = "//";
-            authority.append(u_authority.name());
-        }
-    }
-    return authority;
+    std::string part;
+    BufferSink<std::string> sink(part);
+    writeAuthority(sink, u_authority);
+    return part;
 }
 
 /**
@@ -213,26 +169,29 @@ auto uprotocol::uri::LongUriSerializer::buildAuthorityPartOfUri(const v1::UAutho
  * @param resourceString String that contains the UResource information.
  * @return Returns a UResource object.
  */
-auto uprotocol::uri::LongUriSerializer::parseUResource(const std::string& resource_string) -> v1::UResource {
+auto uprotocol::uri::LongUriSerializer::parseUResource(std::string_view resource_string) -> v1::UResource {
     if (resource_string.empty()) {
         return BuildUResource().build();
     }
-    auto parts = split(resource_string, "#");
+    auto message_pos = resource_string.find('#');
+    auto name_and_instance = resource_string.substr(0, message_pos);
 
     auto builder = BuildUResource();
     
-    auto pos = parts[0].find('.');
-    if (std::string::npos == pos) {
-        builder.setName(parts[0]);
+    auto pos = name_and_instance.find('.');
+    if (std::string_view::npos == pos) {
+        builder.setName(std::string(name_and_instance));
     } else {
-        if (parts[0].substr(pos + 1).empty()) {
-            spdlog::error("Invalid resource instance: {}", parts[0]);
+        if (name_and_instance.substr(pos + 1).empty()) {
+            spdlog::error("Invalid resource instance: {}", name_and_instance);
             return BuildUResource().build();
         }
-        builder.setName(parts[0].substr(0, pos)).setInstance(parts[0].substr(pos + 1));
+        builder.setName(std::string(name_and_instance.substr(0, pos))).
+                setInstance(std::string(name_and_instance.substr(pos + 1)));
     }
-    if (parts.size() > 1) {
-        builder.setMessage(parts[1]);
+    if (std::string_view::npos != message_pos) {
+        auto message = resource_string.substr(message_pos + 1);
+        builder.setMessage(std::string(message.substr(0, message.find('#'))));
     }
     return builder.build();
 }
@@ -244,23 +203,22 @@ auto uprotocol::uri::LongUriSerializer::parseUResource(const std::string& resour
  * @param version String that contains the UEntity version.
  * @return Returns a UEntity object.
  */
-auto uprotocol::uri::LongUriSerializer::parseUEntity(const std::string &entity, const std::string &version) -> v1::UEntity {
+auto uprotocol::uri::LongUriSerializer::parseUEntity(std::string_view entity, std::string_view version) -> v1::UEntity {
     if (0 == entity.length()) {
         return BuildUEntity().build();
     }
     
-    return BuildUEntity().setName(entity).setVersion(version).build();
+    return BuildUEntity().setName(std::string(entity)).setVersion(std::string(version)).build();
 }
 
 /**
- * Static method for creating a UUri using a vector of strings that contains
- * the Local UUri information.
- * @param uriParts Vector of strings that contains the Local UUri information.
+ * Static method for creating a UUri using the segments of a Local UUri.
+ * @param uri_parts Tokenized Local UUri.
  * @return Returns a UUri object.
  */
-auto uprotocol::uri::LongUriSerializer::parseLocalUUri(const std::vector<std::string>& uri_parts) -> v1::UUri {
-    std::string entity_name;
-    std::string version;
+auto uprotocol::uri::LongUriSerializer::parseLocalUUri(const UriTokenizer& uri_parts) -> v1::UUri {
+    std::string_view entity_name;
+    std::string_view version;
     auto u_resource = BuildUResource().build() ;
     auto number_of_parts_in_uri = uri_parts.size();
 
@@ -292,13 +250,12 @@ auto uprotocol::uri::LongUriSerializer::parseLocalUUri(const std::vector<std::st
 }
 
 /**
- * Static method for creating a UUri using a vector of strings that contains
- * the Remote UUri information.
- * @param uriParts Vector of strings that contains the Remote UUri information.
+ * Static method for creating a UUri using the segments of a Remote UUri.
+ * @param uri_parts Tokenized Remote UUri.
  * @return Returns a UUri object.
 */
-auto uprotocol::uri::LongUriSerializer::parseRemoteUUri(const std::vector<std::string>& uri_parts) -> v1::UUri {
-    std::string entity_name;
+auto uprotocol::uri::LongUriSerializer::parseRemoteUUri(const UriTokenizer& uri_parts) -> v1::UUri {
+    std::string_view entity_name;
     auto number_of_parts_in_uri = uri_parts.size();
 
     if (number_of_parts_in_uri < 3) {
@@ -313,13 +270,13 @@ auto uprotocol::uri::LongUriSerializer::parseRemoteUUri(const std::vector<std::s
     if (number_of_parts_in_uri <= i) {
         return BuildUUri().build();
     }
-    auto authority = BuildUAuthority().setName(uri_parts[i]).build();
+    auto authority = BuildUAuthority().setName(std::string(uri_parts[i])).build();
     if (isEmpty(authority)) {
         return BuildUUri().build();
     }
     
     if (uri_parts.size() > 3) {
-        std::string version;
+        std::string_view version;
         ++i;
         entity_name = uri_parts[i];
         if (number_of_parts_in_uri > 4) {
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef LONG_URI_WRITER_H_
+#define LONG_URI_WRITER_H_
+
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <up-cpp/uri/tools/Utils.h>
+#include <up-core-api/uri.pb.h>
+
+/**
+ * Writers of the long URI format into a sink, any type with an
+ * append(std::string_view) member. LongUriSerializer runs them to size and
+ * fill its output, UriHash to hash and compare without building strings.
+ */
+namespace uprotocol::uri::longform {
+
+/**
+ * Sink that only counts the characters written to it, for the sizing pass.
+ */
+class LengthSink {
+public:
+    auto append(std::string_view str) -> void { length_ += str.size(); }
+
+    [[nodiscard]] auto length() const -> std::size_t { return length_; }
+
+private:
+    std::size_t length_ = 0;
+};
+
+/**
+ * Sink that appends to a std::string or a fmt::memory_buffer.
+ */
+template <typename Buffer>
+class BufferSink {
+public:
+    explicit BufferSink(Buffer& buffer) : buffer_(buffer) {}
+
+    auto append(std::string_view str) -> void { buffer_.append(str.data(), str.data() + str.size()); }
+
+private:
+    Buffer& buffer_;
+};
+
+/**
+ * Trim both ends of a string, without copying it.
+ */
+inline auto trimmed(std::string_view str) -> std::string_view {
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front()))) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.back()))) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+template <typename Sink>
+auto writeNumber(Sink& sink, uint32_t value) -> void {
+    std::array<char, 10> digits{};
+    auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    sink.append(std::string_view(digits.data(), static_cast<std::size_t>(result.ptr - digits.data())));
+}
+
+template <typename Sink>
+auto writeAuthority(Sink& sink, const v1::UAuthority& u_authority) -> void {
+    if (isEmpty(u_authority)) {
+        sink.append("/");
+    } else if (u_authority.has_name() && !u_authority.name().empty()) {
+        sink.append("//");
+        sink.append(u_authority.name());
+    }
+}
+
+template <typename Sink>
+auto writeEntity(Sink& sink, const v1::UEntity& entity) -> void {
+    if (isEmpty(entity)) {
+        return;
+    }
+    sink.append(trimmed(entity.name()));
+    sink.append("/");
+    if (entity.has_version_major()) {
+        writeNumber(sink, entity.version_major());
+        if (entity.has_version_minor()) {
+            sink.append(".");
+            writeNumber(sink, entity.version_minor());
+        }
+    }
+}
+
+template <typename Sink>
+auto writeResource(Sink& sink, const v1::UResource& resource) -> void {
+    if (isEmpty(resource)) {
+        return;
+    }
+    sink.append("/");
+    sink.append(resource.name());
+    if (resource.has_instance() && !resource.instance().empty()) {
+        sink.append(".");
+        sink.append(resource.instance());
+    }
+    if (resource.has_message() && !resource.message().empty()) {
+        sink.append("#");
+        sink.append(resource.message());
+    }
+}
+
+/**
+ * Writes the long format of a UUri. Both passes of the serializer run this,
+ * so the computed length always matches what is written.
+ */
+template <typename Sink>
+auto writeUri(Sink& sink, const v1::UUri& uri) -> void {
+    if (isEmpty(uri)) {
+        return;
+    }
+    writeAuthority(sink, uri.authority());
+    // A local authority is already written as "/".
+    if (!isEmpty(uri.authority())) {
+        sink.append("/");
+    }
+    if (isEmpty(uri.entity())) {
+        return;
+    }
+    writeEntity(sink, uri.entity());
+    writeResource(sink, uri.resource());
+}
+
+} // namespace uprotocol::uri::longform
+
+#endif // LONG_URI_WRITER_H_
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include "MicroUriKernels.h"
+
+#ifdef UP_CPP_MICRO_URI_X86
+#include <immintrin.h>
+#endif
+
+namespace uprotocol::uri::micro {
+
+/*
+ * Layout of a local micro URI:
+ *   [0] UpVersion  [1] address type  [2, 3] resource id  [4, 5] entity id  [6] entity version  [7] unused
+ * Ids are big endian. MicroUriSerializer writes the Invalid address type for local URIs, so both
+ * Local and Invalid are accepted, as in MicroUri::parse.
+ */
+static constexpr uint8_t UpVersion = 0x01;
+static constexpr uint8_t LocalType = 0;
+static constexpr uint8_t InvalidType = 4;
+
+static inline void clearInvalid(std::size_t count, uint64_t *invalid) {
+    std::fill(invalid, invalid + (count + 63) / 64, 0);
+}
+
+/**
+ * Decodes the URIs [n, count) one at a time.
+ * @return Number of valid URIs.
+ */
+static std::size_t decodeRange(const uint8_t *in, std::size_t n, std::size_t count, uint16_t *entity_ids,
+                               uint8_t *entity_versions, uint16_t *resource_ids, uint64_t *invalid) {
+    std::size_t valid = 0;
+    for (in += n * LocalLength; n < count; ++n, in += LocalLength) {
+        if (UpVersion == in[0] && (LocalType == in[1] || InvalidType == in[1])) {
+            resource_ids[n] = static_cast<uint16_t>((in[2] << 8) | in[3]);
+            entity_ids[n] = static_cast<uint16_t>((in[4] << 8) | in[5]);
+            entity_versions[n] = in[6];
+            ++valid;
+        } else {
+            resource_ids[n] = 0;
+            entity_ids[n] = 0;
+            entity_versions[n] = 0;
+            invalid[n / 64] |= uint64_t{1} << (n % 64);
+        }
+    }
+    return valid;
+}
+
+std::size_t decodeScalar(const uint8_t *in, std::size_t count, uint16_t *entity_ids, uint8_t *entity_versions,
+                         uint16_t *resource_ids, uint64_t *invalid) {
+    clearInvalid(count, invalid);
+    return decodeRange(in, 0, count, entity_ids, entity_versions, resource_ids, invalid);
+}
+
+#ifdef UP_CPP_MICRO_URI_X86
+
+#define UP_CPP_Z -128
+
+/*
+ * Both kernels decode 8 URIs from 4 registers of 2 URIs, a and b. Each register is first shuffled to
+ *   [entity a, entity b][resource a, resource b][version a, version b, 0 a, 0 b][1 a, 1 b, -, -]
+ * with the ids byte swapped and k the byte at position k. 32 bit unpacks then gather each field of
+ * the 8 URIs, so the 8 entity ids and the 8 resource ids are contiguous.
+ */
+#define UP_CPP_MICRO_SPLIT 5, 4, 13, 12, 3, 2, 11, 10, 6, 14, 0, 8, 1, 9, UP_CPP_Z, UP_CPP_Z
+/** versions then byte 0 of the 8 URIs, from the third dwords */
+#define UP_CPP_MICRO_VERSIONS 0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15
+/** byte 1 of the 8 URIs, from the fourth dwords */
+#define UP_CPP_MICRO_TYPES 0, 1, 4, 5, 8, 9, 12, 13, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, \
+                           UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z
+
+__attribute__((target("sse4.1")))
+std::size_t decodeSse41(const uint8_t *in, std::size_t count, uint16_t *entity_ids, uint8_t *entity_versions,
+                        uint16_t *resource_ids, uint64_t *invalid) {
+    clearInvalid(count, invalid);
+    const __m128i split = _mm_setr_epi8(UP_CPP_MICRO_SPLIT);
+    const __m128i versions_index = _mm_setr_epi8(UP_CPP_MICRO_VERSIONS);
+    const __m128i types_index = _mm_setr_epi8(UP_CPP_MICRO_TYPES);
+
+    std::size_t valid_count = 0;
+    std::size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        const auto *block = reinterpret_cast<const __m128i *>(in + n * LocalLength);
+        auto s0 = _mm_shuffle_epi8(_mm_loadu_si128(block), split);
+        auto s1 = _mm_shuffle_epi8(_mm_loadu_si128(block + 1), split);
+        auto s2 = _mm_shuffle_epi8(_mm_loadu_si128(block + 2), split);
+        auto s3 = _mm_shuffle_epi8(_mm_loadu_si128(block + 3), split);
+        auto ids01 = _mm_unpacklo_epi32(s0, s1);
+        auto ids23 = _mm_unpacklo_epi32(s2, s3);
+        auto rest01 = _mm_unpackhi_epi32(s0, s1);
+        auto rest23 = _mm_unpackhi_epi32(s2, s3);
+        auto versions = _mm_shuffle_epi8(_mm_unpacklo_epi64(rest01, rest23), versions_index);
+        auto types = _mm_shuffle_epi8(_mm_unpackhi_epi64(rest01, rest23), types_index);
+
+        // byte 0 is in the high half of versions
+        auto up_version = _mm_cmpeq_epi8(_mm_unpackhi_epi64(versions, versions), _mm_set1_epi8(UpVersion));
+        auto local = _mm_or_si128(_mm_cmpeq_epi8(types, _mm_set1_epi8(LocalType)),
+                                  _mm_cmpeq_epi8(types, _mm_set1_epi8(InvalidType)));
+        auto ok = _mm_and_si128(up_version, local);
+        auto ok16 = _mm_unpacklo_epi8(ok, ok);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(entity_ids + n), _mm_and_si128(_mm_unpacklo_epi64(ids01, ids23), ok16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(resource_ids + n), _mm_and_si128(_mm_unpackhi_epi64(ids01, ids23), ok16));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(entity_versions + n), _mm_and_si128(versions, ok));
+
+        auto valid = static_cast<uint32_t>(_mm_movemask_epi8(ok)) & 0xff;
+        invalid[n / 64] |= static_cast<uint64_t>(~valid & 0xff) << (n % 64);
+        valid_count += __builtin_popcount(valid);
+    }
+    return valid_count + decodeRange(in, n, count, entity_ids, entity_versions, resource_ids, invalid);
+}
+
+/**
+ * Same 16 bytes shuffle in both lanes.
+ */
+#define UP_CPP_LANES(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+/**
+ * Loads 2 URIs of the first 8 in the low lane, and the same 2 of the next 8 in the high lane.
+ */
+__attribute__((target("avx2")))
+static inline auto loadPair(const uint8_t *in) -> __m256i {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in))),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 8 * LocalLength)), 1);
+}
+
+__attribute__((target("avx2")))
+std::size_t decodeAvx2(const uint8_t *in, std::size_t count, uint16_t *entity_ids, uint8_t *entity_versions,
+                       uint16_t *resource_ids, uint64_t *invalid) {
+    clearInvalid(count, invalid);
+    const __m256i split = UP_CPP_LANES(UP_CPP_MICRO_SPLIT);
+    const __m256i versions_index = UP_CPP_LANES(UP_CPP_MICRO_VERSIONS);
+    const __m256i types_index = UP_CPP_LANES(UP_CPP_MICRO_TYPES);
+
+    std::size_t valid_count = 0;
+    std::size_t n = 0;
+    // 16 URIs per iteration, the first 8 in the low lanes and the next 8 in the high lanes
+    for (; n + 16 <= count; n += 16) {
+        const auto *block = in + n * LocalLength;
+        auto s0 = _mm256_shuffle_epi8(loadPair(block), split);
+        auto s1 = _mm256_shuffle_epi8(loadPair(block + 16), split);
+        auto s2 = _mm256_shuffle_epi8(loadPair(block + 32), split);
+        auto s3 = _mm256_shuffle_epi8(loadPair(block + 48), split);
+        auto ids01 = _mm256_unpacklo_epi32(s0, s1);
+        auto ids23 = _mm256_unpacklo_epi32(s2, s3);
+        auto rest01 = _mm256_unpackhi_epi32(s0, s1);
+        auto rest23 = _mm256_unpackhi_epi32(s2, s3);
+        auto versions = _mm256_shuffle_epi8(_mm256_unpacklo_epi64(rest01, rest23), versions_index);
+        auto types = _mm256_shuffle_epi8(_mm256_unpackhi_epi64(rest01, rest23), types_index);
+
+        auto up_version = _mm256_cmpeq_epi8(_mm256_unpackhi_epi64(versions, versions), _mm256_set1_epi8(UpVersion));
+        auto local = _mm256_or_si256(_mm256_cmpeq_epi8(types, _mm256_set1_epi8(LocalType)),
+                                     _mm256_cmpeq_epi8(types, _mm256_set1_epi8(InvalidType)));
+        auto ok = _mm256_and_si256(up_version, local);
+        auto ok16 = _mm256_unpacklo_epi8(ok, ok);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(entity_ids + n),
+                            _mm256_and_si256(_mm256_unpacklo_epi64(ids01, ids23), ok16));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(resource_ids + n),
+                            _mm256_and_si256(_mm256_unpackhi_epi64(ids01, ids23), ok16));
+        // the versions are the low 8 bytes of each lane
+        auto packed = _mm256_permute4x64_epi64(_mm256_and_si256(versions, ok), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(entity_versions + n), _mm256_castsi256_si128(packed));
+
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(ok));
+        auto valid = (mask & 0xff) | ((mask >> 8) & 0xff00);
+        invalid[n / 64] |= static_cast<uint64_t>(~valid & 0xffff) << (n % 64);
+        valid_count += __builtin_popcount(valid);
+    }
+    return valid_count + decodeRange(in, n, count, entity_ids, entity_versions, resource_ids, invalid);
+}
+
+#undef UP_CPP_LANES
+#undef UP_CPP_MICRO_TYPES
+#undef UP_CPP_MICRO_VERSIONS
+#undef UP_CPP_MICRO_SPLIT
+#undef UP_CPP_Z
+
+#endif // UP_CPP_MICRO_URI_X86
+
+} // namespace uprotocol::uri::micro
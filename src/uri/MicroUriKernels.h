@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MICRO_URI_KERNELS_H_
+#define MICRO_URI_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Bulk decoding of local micro URIs, stored back to back, into one array
+ * per field. Every kernel gives identical results; the vector ones are only
+ * available when the CPU supports their instruction set.
+ */
+namespace uprotocol::uri::micro {
+
+/** Number of bytes of a local micro URI */
+constexpr std::size_t LocalLength = 8;
+
+/**
+ * Decodes count local micro URIs. Invalid ones are decoded as 0 and their
+ * bit is set in invalid, which has (count + 63) / 64 words.
+ * @return Number of valid URIs.
+ */
+using DecodeKernel = std::size_t (*)(const uint8_t *in, std::size_t count, uint16_t *entity_ids,
+                                     uint8_t *entity_versions, uint16_t *resource_ids, uint64_t *invalid);
+
+std::size_t decodeScalar(const uint8_t *in, std::size_t count, uint16_t *entity_ids, uint8_t *entity_versions,
+                         uint16_t *resource_ids, uint64_t *invalid);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UP_CPP_MICRO_URI_X86 1
+
+std::size_t decodeSse41(const uint8_t *in, std::size_t count, uint16_t *entity_ids, uint8_t *entity_versions,
+                        uint16_t *resource_ids, uint64_t *invalid);
+
+std::size_t decodeAvx2(const uint8_t *in, std::size_t count, uint16_t *entity_ids, uint8_t *entity_versions,
+                       uint16_t *resource_ids, uint64_t *invalid);
+#endif
+
+} // namespace uprotocol::uri::micro
+
+#endif // MICRO_URI_KERNELS_H_
@@ -24,43 +24,54 @@
  */
 
 
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <up-cpp/uri/serializer/MicroUriSerializer.h>
 #include <up-cpp/uri/serializer/IpAddress.h>
+#include "MicroUriKernels.h"
 
 using uprotocol::uri::IpAddress;
 using AddressType = IpAddress::AddressType;
 using namespace uprotocol::uri;
 
+static_assert(micro::LocalLength == MicroUriSerializer::LocalMicroUriLength);
+
 /**
  * Static method for creating a remote authority supporting the micro serialization information representation of a UUri.<br>
  * Building a UAuthority with this method will create an unresolved uAuthority that can only be serialised in micro UUri format.
- * @param address The ip address of the device a software entity is deployed on.
+ * @param addr The ip address bytes of the device a software entity is deployed on.
+ * @param type IpV4 or IpV6
  * @return Returns a uAuthority that contains only the internet address of the device, and can only be serialized in micro UUri format.
  */
-[[nodiscard]] static auto createMicroRemote(const std::string& address) -> uprotocol::v1::UAuthority {
-    if (isBlank(address)) {
-        spdlog::error("Address is blank");
+[[nodiscard]] static auto createMicroRemote(const uint8_t* addr, AddressType type) -> uprotocol::v1::UAuthority {
+    const auto length = (type == AddressType::IpV4) ? IpAddress::IpV4AddressBytes : IpAddress::IpV6AddressBytes;
+    auto ip = IpAddress(addr, length, type).normalized();
+    if (ip.empty()) {
         return uprotocol::uri::BuildUAuthority().build();
     }
-    
-    auto authority = uprotocol::uri::BuildUAuthority().setIp(address).build();
+    // normalized() already gives the normalized text BuildUAuthority::setIp() would
+    uprotocol::v1::UAuthority authority;
+    authority.set_ip(std::move(ip));
     return authority;
 }
 
 /**
  * Static method for creating a remote authority supporting the micro serialization information representation of a UUri.<br>
  * using ID
- * @param id_vec 
+ * @param id_bytes the id length byte followed by the id
+ * @param size number of bytes of id_bytes
  * @return 
  */
-[[nodiscard]] static auto createMicroRemoteWithId(const std::vector<uint8_t> &id_vec) -> uprotocol::v1::UAuthority {
-    auto id = std::string(id_vec.begin() + 1, id_vec.end());
+[[nodiscard]] static auto createMicroRemoteWithId(const uint8_t* id_bytes, std::size_t size) -> uprotocol::v1::UAuthority {
+    auto id = size > 1 ? std::string_view(reinterpret_cast<const char*>(id_bytes) + 1, size - 1) : std::string_view();
     if (isBlank(id)) {
         spdlog::error("Id is blank");
         return uprotocol::uri::BuildUAuthority().build();
     }
     
-    auto authority = uprotocol::uri::BuildUAuthority().setId(id).build();
+    uprotocol::v1::UAuthority authority;
+    authority.set_id(id.data(), id.size());
     return authority;
 }
 
@@ -70,92 +81,116 @@ using namespace uprotocol::uri;
  * @return Returns a vector<uint8_t> representing the serialized UUri.
  */
 auto MicroUriSerializer::serialize(const uprotocol::v1::UUri& u_uri) -> std::vector<uint8_t> {
-    if (isEmpty(u_uri) || !isMicroForm(u_uri)) {
-        return std::vector<uint8_t>();
-    }
-   
-    std::vector<uint8_t> uri;
-    std::string address;
-    if (u_uri.authority().has_ip()) {
-        address = u_uri.authority().ip();
-    } else if (u_uri.authority().has_id()) {
-        address = u_uri.authority().id();
-    }
-    
-    auto entity_id = u_uri.entity().id();
-    decltype(u_uri.entity().version_major()) version = 0;
-    if (u_uri.entity().has_version_major()) {
-        version = u_uri.entity().version_major();
+    std::array<uint8_t, MaxMicroUriLength> uri{};
+    const auto size = serializeInto(u_uri, uri.data(), uri.size());
+    return std::vector<uint8_t>(uri.begin(), uri.begin() + size);
+}
+
+/**
+ * Serialize a UUri into a caller provided buffer following the Micro-URI specifications.
+ * @param u_uri The UUri data object.
+ * @param micro_uri buffer for the micro URI
+ * @param capacity number of bytes of micro_uri
+ * @return Returns the number of bytes written, 0 if the UUri cannot be serialized or does not fit.
+ */
+auto MicroUriSerializer::serializeInto(const uprotocol::v1::UUri& u_uri, uint8_t* micro_uri, std::size_t capacity) -> std::size_t {
+    MicroUri uri;
+    if (!toMicroUri(u_uri, uri)) {
+        return 0;
     }
-    auto resource_id = u_uri.resource().id();
+    return uri.serialize(micro_uri, capacity);
+}
 
-    // UP_VERSION
-    uri.push_back(UpVersion);
-    
-    AddressType address_type = AddressType::Invalid;
-    if (!address.empty() && u_uri.authority().has_ip()) {
-        uprotocol::uri::IpAddress ip_address(address);
-        if (address_type = ip_address.getType(); address_type == AddressType::Invalid) {
-            return std::vector<uint8_t>();
-        }
-    } else if (!address.empty() && u_uri.authority().has_id()) {
-        address_type = AddressType::Id;
+/**
+ * Convert a UUri to a MicroUri.
+ * @param u_uri The UUri data object.
+ * @param micro_uri the micro URI
+ * @return false if the UUri cannot be serialized in the micro format.
+ */
+auto MicroUriSerializer::toMicroUri(const uprotocol::v1::UUri& u_uri, MicroUri& micro_uri) -> bool {
+    if (isEmpty(u_uri) || !isMicroForm(u_uri)) {
+        return false;
     }
-    
-    uri.push_back(static_cast<uint8_t>(address_type));
 
-    // URESOURCE_ID
-    uri.push_back(static_cast<uint8_t>(resource_id >> 8)); // 8 msb bits
-    uri.push_back(static_cast<uint8_t>(resource_id & 0xFF)); // 8 lsb bits
-    
-    // UENTITY_ID
-    uri.push_back(static_cast<uint8_t>(entity_id >> 8)); // 8 msb bits
-    uri.push_back(static_cast<uint8_t>(entity_id & 0xFF)); // 8 lsb bits
-    
-    // UENTITY_VERSION
-    auto version_string = std::to_string(version);
-    uri.push_back(version_string.empty() ? 0 : static_cast<unsigned char>(std::stoi(version_string)));
-    
-    // UNUSED
-    uri.push_back(0);
-    
     // UAUTORITY_ADDRESS
-    if (address.empty()) {
-        return uri;
+    MicroUri uri;
+    const auto& authority = u_uri.authority();
+    if (authority.has_ip() && !authority.ip().empty()) {
+        const IpAddress ip(authority.ip());
+        if (ip.getType() != AddressType::IpV4 && ip.getType() != AddressType::IpV6) {
+            return false;
+        }
+        uri.addressType = ip.getType();
+        uri.addressLength = static_cast<uint8_t>(ip.size());
+        std::memcpy(uri.ip.data(), ip.data(), ip.size());
+    } else if (authority.has_id() && !authority.id().empty()) {
+        if (authority.id().size() > UAutorityIdMaxLength) {
+            spdlog::error("UAuthority id is longer than {} bytes", UAutorityIdMaxLength);
+            return false;
+        }
+        uri.addressType = AddressType::Id;
+        uri.addressLength = static_cast<uint8_t>(authority.id().size());
+        uri.id = reinterpret_cast<const uint8_t*>(authority.id().data());
     }
-    
-    // not local, then it is a remote address with IP
-    addIpOrId(u_uri, uri, address);
-    
-    return uri;
+
+    uri.entityId = static_cast<uint16_t>(u_uri.entity().id());
+    uri.entityVersion = static_cast<uint8_t>(u_uri.entity().has_version_major() ? u_uri.entity().version_major() : 0);
+    uri.resourceId = static_cast<uint16_t>(u_uri.resource().id());
+    micro_uri = uri;
+    return true;
 }
 
 /**
- * build the authority address part of the micro uri
- * @param u_uri 
- * @param uri 
- * @param address 
+ * Convert a MicroUri to a UUri.
+ * @param micro_uri The micro URI.
+ * @return Returns an UUri data object.
  */
-auto MicroUriSerializer::addIpOrId(const uprotocol::v1::UUri &u_uri, std::vector<uint8_t> &uri, std::string &address) -> void {
-    if (u_uri.authority().has_ip()) {
-        IpAddress ip_address(address);
-        std::vector<uint8_t> ip = ip_address.getBytes();
-        uri.insert(uri.end(), ip.begin(), ip.end());
-    } else if (u_uri.authority().has_id()) {
-        std::vector<uint8_t> id(address.begin(), address.end());
-        uri.push_back(static_cast<uint8_t>(address.size()));
-        uri.insert(uri.end(), id.begin(), id.end());
+auto MicroUriSerializer::toUUri(const MicroUri& micro_uri) -> uprotocol::v1::UUri {
+    // filled in place, as BuildUUri would, without copying each part
+    uprotocol::v1::UUri u_uri;
+    switch (micro_uri.addressType) {
+        case AddressType::IpV4:
+        case AddressType::IpV6:
+            if (auto u_authority = createMicroRemote(micro_uri.ip.data(), micro_uri.addressType); !isEmpty(u_authority)) {
+                *u_uri.mutable_authority() = std::move(u_authority);
+            }
+            break;
+        case AddressType::Id:
+            if (const auto id = micro_uri.address(); !isBlank(id)) {
+                u_uri.mutable_authority()->set_id(id.data(), id.size());
+            }
+            break;
+        default:
+            break;
+    }
+    auto* u_entity = u_uri.mutable_entity();
+    if (0 != micro_uri.entityId) {
+        u_entity->set_id(micro_uri.entityId);
+    }
+    u_entity->set_version_major(micro_uri.entityVersion);
+    if (0 != micro_uri.resourceId) {
+        u_uri.mutable_resource()->set_id(micro_uri.resourceId);
     }
+    return u_uri;
 }
 
-
 /**
  * Deserialize a vector<uint8_t> into a UUri object.
  * @param microUri A vector<uint8_t> uProtocol micro URI.
  * @return Returns an UUri data object from the serialized format of a microUri.
  */
 auto MicroUriSerializer::deserialize(std::vector<uint8_t> const& micro_uri) -> uprotocol::v1::UUri {
-    if (micro_uri.empty() || micro_uri.size() < LocalMicroUriLength) {
+    return deserialize(micro_uri.data(), micro_uri.size());
+}
+
+/**
+ * Deserialize micro URI bytes into a UUri object.
+ * @param micro_uri A uProtocol micro URI.
+ * @param size number of bytes of micro_uri
+ * @return Returns an UUri data object from the serialized format of a microUri.
+ */
+auto MicroUriSerializer::deserialize(const uint8_t* micro_uri, std::size_t size) -> uprotocol::v1::UUri {
+    if (nullptr == micro_uri || size < LocalMicroUriLength) {
         return BuildUUri().build();
     }
     // IPADDRESS_TYPE
@@ -163,7 +198,7 @@ auto MicroUriSerializer::deserialize(std::vector<uint8_t> const& micro_uri) -> u
     if (!address_type) {
         return BuildUUri().build();
     }
-    if (!checkMicroUriSize(micro_uri.size(), address_type.value())) {
+    if (!checkMicroUriSize(size, address_type.value())) {
         return BuildUUri().build();
     }
     if (micro_uri[0] != UpVersion) {
@@ -171,8 +206,7 @@ auto MicroUriSerializer::deserialize(std::vector<uint8_t> const& micro_uri) -> u
         return BuildUUri().build();
     }
     // UAUTORITY_ADDRESS
-    std::vector<uint8_t> ip(micro_uri.begin() + IpaddressStartPosition, micro_uri.end());
-    auto u_authority = getUauthority(ip, address_type.value());
+    auto u_authority = getUauthority(micro_uri + IpaddressStartPosition, size - IpaddressStartPosition, address_type.value());
     // UENTITY_ID
     auto entity_id = (static_cast<uint16_t>(micro_uri[EntityIdStartPosition]) << 8) | micro_uri[EntityIdStartPosition + 1];
     // UE_VERSION
@@ -180,15 +214,20 @@ auto MicroUriSerializer::deserialize(std::vector<uint8_t> const& micro_uri) -> u
     // URESOURCE_ID
     auto resource_id = (static_cast<uint16_t>(micro_uri[ResourceIdPosition]) << 8) | (micro_uri[ResourceIdPosition + 1]);
     
-    return BuildUUri().setAutority(u_authority).
-                       setEntity(BuildUEntity().
-                                 setId(entity_id).
-                                 setMajorVersion(major_version).
-                                 build()).
-                       setResource(BuildUResource().
-                                   setID(resource_id).
-                                   build()).
-                       build();
+    // filled in place, as BuildUUri would, without copying each part
+    uprotocol::v1::UUri u_uri;
+    if (!isEmpty(u_authority)) {
+        *u_uri.mutable_authority() = std::move(u_authority);
+    }
+    auto* u_entity = u_uri.mutable_entity();
+    if (0 != entity_id) {
+        u_entity->set_id(entity_id);
+    }
+    u_entity->set_version_major(major_version);
+    if (0 != resource_id) {
+        u_uri.mutable_resource()->set_id(resource_id);
+    }
+    return u_uri;
 }
 
 /**
@@ -254,23 +293,86 @@ auto MicroUriSerializer::checkMicroUriSize(std::size_t size, AddressType address
 
 /**
  * get UAuthority from IP address or ID
- * @param addr vector that containes either IP address or ID
+ * @param addr bytes that contain either IP address or ID
+ * @param size number of bytes of addr
  * @param type AddressType type of the passed address
  * @return uprotocol::v1::UAuthority. If the address is empty or illegal, then it returns an empty UAuthority.
  */
-auto MicroUriSerializer::getUauthority(const std::vector<uint8_t> &addr, AddressType type) -> uprotocol::v1::UAuthority {
+auto MicroUriSerializer::getUauthority(const uint8_t* addr, std::size_t size, AddressType type) -> uprotocol::v1::UAuthority {
     switch (type) {
         case AddressType::IpV4:
         case AddressType::IpV6: {
-            IpAddress ip_address(addr, type);
-            return createMicroRemote(ip_address.getString());
+            const std::size_t length = (type == AddressType::IpV4) ? IpAddress::IpV4AddressBytes : IpAddress::IpV6AddressBytes;
+            if (size < length) {
+                spdlog::error("Address is blank");
+                return BuildUAuthority().build();
+            }
+            return createMicroRemote(addr, type);
         }
         case AddressType::Id: {
-            return createMicroRemoteWithId(addr);
+            return createMicroRemoteWithId(addr, size);
         }
         default:
             return BuildUAuthority().build();
     }
 };
 
+/**
+ * @return true if the CPU supports the kernel
+ */
+static auto isSupported(MicroUriSerializer::BatchKernel kernel) -> bool {
+    switch (kernel) {
+        case MicroUriSerializer::BatchKernel::Scalar:
+            return true;
+#ifdef UP_CPP_MICRO_URI_X86
+        case MicroUriSerializer::BatchKernel::Sse41:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1");
+        case MicroUriSerializer::BatchKernel::Avx2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * @return the best kernel supported by the CPU
+ */
+static auto bestBatchKernel() -> MicroUriSerializer::BatchKernel {
+    for (auto kernel : {MicroUriSerializer::BatchKernel::Avx2, MicroUriSerializer::BatchKernel::Sse41}) {
+        if (isSupported(kernel)) {
+            return kernel;
+        }
+    }
+    return MicroUriSerializer::BatchKernel::Scalar;
+}
+
+static std::atomic<MicroUriSerializer::BatchKernel> batchKernel_{bestBatchKernel()};
 
+auto MicroUriSerializer::setBatchKernel(BatchKernel kernel) -> bool {
+    if (!isSupported(kernel)) {
+        return false;
+    }
+    batchKernel_.store(kernel, std::memory_order_relaxed);
+    return true;
+}
+
+auto MicroUriSerializer::getBatchKernel() -> BatchKernel {
+    return batchKernel_.load(std::memory_order_relaxed);
+}
+
+auto MicroUriSerializer::deserializeLocalBatch(const uint8_t* micro_uris, std::size_t count, uint16_t* entity_ids,
+                                               uint8_t* entity_versions, uint16_t* resource_ids, uint64_t* invalid) -> std::size_t {
+    switch (getBatchKernel()) {
+#ifdef UP_CPP_MICRO_URI_X86
+        case BatchKernel::Avx2:
+            return micro::decodeAvx2(micro_uris, count, entity_ids, entity_versions, resource_ids, invalid);
+        case BatchKernel::Sse41:
+            return micro::decodeSse41(micro_uris, count, entity_ids, entity_versions, resource_ids, invalid);
+#endif
+        default:
+            return micro::decodeScalar(micro_uris, count, entity_ids, entity_versions, resource_ids, invalid);
+    }
+}
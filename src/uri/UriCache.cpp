@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <up-cpp/uri/cache/UriCache.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/tools/Utils.h>
+#include <up-cpp/uri/validator/LongUriValidator.h>
+
+using namespace uprotocol::uri;
+
+/**
+ * Constructor. The shards get capacity / shards URIs each, the first
+ * capacity % shards of them one more, so the capacity is never exceeded.
+ * @param capacity Maximum number of cached URIs, spread evenly over the shards.
+ * @param shards Number of shards.
+ */
+UriCache::UriCache(std::size_t capacity, std::size_t shards) {
+    capacity_ = std::max<std::size_t>(capacity, 1);
+    shards = std::clamp<std::size_t>(shards, 1, capacity_);
+    shards_.reserve(shards);
+    for (std::size_t i = 0; i < shards; ++i) {
+        shards_.push_back(std::make_unique<Shard>());
+        shards_.back()->capacity = capacity_ / shards + (i < capacity_ % shards ? 1 : 0);
+    }
+}
+
+/**
+ * Get the deserialized URI, parsing and caching it if it is not cached yet.
+ * The URI is parsed outside of the shard lock, so a slow parse does not block
+ * readers of the same shard. If two threads miss on the same URI, the first
+ * one to insert it wins and both return the same entry. Invalid URIs are
+ * not deserialized, so the ones that make deserialize throw are cached too.
+ * @param uri A long format uProtocol URI.
+ * @return Returns the cached entry.
+ */
+auto UriCache::get(std::string_view uri) -> std::shared_ptr<const Entry> {
+    auto &shard = shardOf(uri);
+    {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        if (auto it = shard.index.find(uri); it != shard.index.end()) {
+            auto &node = shard.nodes[it->second];
+            // only write the cache line when the bit changes
+            if (!node.referenced.load(std::memory_order_relaxed)) {
+                node.referenced.store(true, std::memory_order_relaxed);
+            }
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return node.entry;
+        }
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+
+    auto entry = LongUriValidator::isValid(uri)
+        ? std::make_shared<const Entry>(Entry{LongUriSerializer::deserialize(uri), true})
+        : std::make_shared<const Entry>(Entry{v1::UUri(), false});
+
+    std::lock_guard<std::shared_mutex> lock(shard.mutex);
+    if (auto it = shard.index.find(uri); it != shard.index.end()) {
+        return shard.nodes[it->second].entry;
+    }
+    if (shard.nodes.size() < shard.capacity) {
+        shard.nodes.emplace_back(uri, entry);
+        shard.index.emplace(shard.nodes.back().key, shard.nodes.size() - 1);
+        return entry;
+    }
+    auto victim = evict(shard);
+    auto &node = shard.nodes[victim];
+    shard.index.erase(node.key);
+    node.key.assign(uri);
+    node.entry = entry;
+    node.referenced.store(false, std::memory_order_relaxed);
+    shard.index.emplace(node.key, victim);
+    return entry;
+}
+
+/**
+ * Select the node to evict from a full shard. The hand clears the referenced
+ * bits it passes over, and stops on the first node that was not referenced
+ * since the last pass. It moves past the returned node, so a new entry gets
+ * a full round before being considered again.
+ * @param shard The shard, locked exclusively.
+ * @return the index of the node.
+ */
+auto UriCache::evict(Shard& shard) -> std::size_t {
+    while (true) {
+        auto current = shard.hand;
+        shard.hand = (current + 1) % shard.nodes.size();
+        if (!shard.nodes[current].referenced.exchange(false, std::memory_order_relaxed)) {
+            return current;
+        }
+    }
+}
+
+/**
+ * Cached equivalent of LongUriSerializer::deserialize.
+ * @param uri A long format uProtocol URI.
+ * @return Returns the shared UUri, sharing the ownership of the cache entry.
+ */
+auto UriCache::deserialize(std::string_view uri) -> std::shared_ptr<const v1::UUri> {
+    auto entry = get(uri);
+    return std::shared_ptr<const v1::UUri>(entry, &entry->uri);
+}
+
+auto UriCache::hits() const -> uint64_t {
+    uint64_t hits = 0;
+    for (const auto &shard : shards_) {
+        hits += shard->hits.load(std::memory_order_relaxed);
+    }
+    return hits;
+}
+
+auto UriCache::misses() const -> uint64_t {
+    uint64_t misses = 0;
+    for (const auto &shard : shards_) {
+        misses += shard->misses.load(std::memory_order_relaxed);
+    }
+    return misses;
+}
+
+auto UriCache::size() const -> std::size_t {
+    std::size_t size = 0;
+    for (const auto &shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        size += shard->nodes.size();
+    }
+    return size;
+}
+
+auto UriCache::clear() -> void {
+    for (const auto &shard : shards_) {
+        std::lock_guard<std::shared_mutex> lock(shard->mutex);
+        shard->index.clear();
+        shard->nodes.clear();
+        shard->hand = 0;
+        shard->hits.store(0, std::memory_order_relaxed);
+        shard->misses.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Select the shard of a URI from its hash.
+ * @param uri A long format uProtocol URI.
+ * @return the shard.
+ */
+auto UriCache::shardOf(std::string_view uri) -> Shard& {
+    return *shards_[std::hash<std::string_view>{}(uri) % shards_.size()];
+}
@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <tuple>
+#include <unordered_set>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <spdlog/spdlog.h>
+#include <up-cpp/uri/builder/BuildEntity.h>
+#include <up-cpp/uri/builder/BuildUAuthority.h>
+#include <up-cpp/uri/builder/BuildUResource.h>
+#include <up-cpp/uri/resolver/UriCatalogue.h>
+#include <up-cpp/uri/tools/Utils.h>
+
+using namespace uprotocol::uri;
+
+namespace {
+
+/*
+ * File layout, in host byte order, every offset from the start of the file:
+ *
+ *   FileHeader
+ *   for each table: Record[count], then the seeds and slots of its name
+ *                   index, then those of its id index (uint32_t each)
+ *   strings, not terminated
+ *
+ * A slot holds the position of its record in the table, or PerfectHash::Empty.
+ */
+
+constexpr std::array<char, 8> Magic = {'U', 'P', 'U', 'R', 'I', 'C', 'A', 'T'};
+/** Read back as another value on a host of the other byte order */
+constexpr uint32_t ByteOrderMark = 0x01020304;
+constexpr uint32_t FormatVersion = 1;
+
+enum Table : std::size_t { Authorities, Entities, Resources, TableCount };
+
+struct IndexHeader {
+    uint32_t buckets;
+    uint32_t slots;
+    uint32_t seedsOffset;
+    uint32_t slotsOffset;
+};
+
+struct TableHeader {
+    uint32_t count;
+    uint32_t recordsOffset;
+    IndexHeader byName;
+    IndexHeader byId;
+};
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint32_t byteOrder;
+    uint32_t version;
+    uint64_t size;
+    std::array<TableHeader, TableCount> tables;
+};
+
+/**
+ * An authority, entity or resource.
+ */
+struct Record {
+    /**
+     * Id of the owning entity for a resource, otherwise 0.
+     */
+    uint32_t scope;
+    /**
+     * Id of an entity or resource.
+     */
+    uint32_t id;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    /**
+     * Id of an authority.
+     */
+    uint32_t keyOffset;
+    uint32_t keyLength;
+};
+
+static_assert(sizeof(IndexHeader) == 16 && sizeof(TableHeader) == 40 && sizeof(FileHeader) == 144 &&
+              sizeof(Record) == 24, "the catalogue format must not depend on padding");
+
+/**
+ * Resource name and instance, without the message.
+ */
+auto resourceKey(std::string_view resource) -> std::string_view {
+    return resource.substr(0, resource.find('#'));
+}
+
+auto nameHash(std::string_view name, uint32_t scope, uint32_t seed) -> uint64_t {
+    return PerfectHash::hash(name, seed, scope);
+}
+
+auto idHash(uint32_t scope, uint32_t id, uint32_t seed) -> uint64_t {
+    return PerfectHash::hash((static_cast<uint64_t>(scope) << 32) | id, seed);
+}
+
+/**
+ * A record before it is written.
+ */
+struct Entry {
+    uint32_t scope;
+    uint32_t id;
+    std::string name;
+    std::string key;
+};
+
+/**
+ * Hash of the name of an entry, and of its id.
+ */
+auto entryNameHash(Table table, const Entry& entry, uint32_t seed) -> uint64_t {
+    return nameHash(Resources == table ? resourceKey(entry.name) : std::string_view(entry.name), entry.scope, seed);
+}
+
+auto entryIdHash(Table table, const Entry& entry, uint32_t seed) -> uint64_t {
+    return Authorities == table ? nameHash(entry.key, 0, seed) : idHash(entry.scope, entry.id, seed);
+}
+
+/**
+ * Drop the entries whose name or id is already taken by an earlier one.
+ */
+auto dedup(Table table, std::vector<Entry> entries) -> std::vector<Entry> {
+    std::unordered_set<std::string> names;
+    std::unordered_set<std::string> ids;
+    std::vector<Entry> kept;
+    for (auto& entry : entries) {
+        auto scope = std::to_string(entry.scope) + '/';
+        auto name = scope + std::string(Resources == table ? resourceKey(entry.name) : entry.name);
+        auto id = Authorities == table ? entry.key : scope + std::to_string(entry.id);
+        if (names.count(name) == 0 && ids.count(id) == 0) {
+            names.insert(std::move(name));
+            ids.insert(std::move(id));
+            kept.push_back(std::move(entry));
+        }
+    }
+    return kept;
+}
+
+/**
+ * Catalogue file being written.
+ */
+class Writer {
+public:
+    Writer() : bytes_(sizeof(FileHeader), 0) {}
+
+    void addTable(Table table, const std::vector<Entry>& entries) {
+        auto& header = headers_[table];
+        header.count = static_cast<uint32_t>(entries.size());
+        header.recordsOffset = static_cast<uint32_t>(bytes_.size());
+        bytes_.resize(bytes_.size() + entries.size() * sizeof(Record));
+        header.byName = addIndex(PerfectHash::build(entries.size(), [&](std::size_t i, uint32_t seed) {
+            return entryNameHash(table, entries[i], seed);
+        }));
+        header.byId = addIndex(PerfectHash::build(entries.size(), [&](std::size_t i, uint32_t seed) {
+            return entryIdHash(table, entries[i], seed);
+        }));
+        pending_.emplace_back(table, &entries);
+    }
+
+    /**
+     * Append the strings, fill in the records and the header.
+     */
+    auto finish() -> const std::vector<uint8_t>& {
+        for (auto [table, entries] : pending_) {
+            auto offset = headers_[table].recordsOffset;
+            for (const auto& entry : *entries) {
+                Record record{entry.scope, entry.id, 0, 0, 0, 0};
+                std::tie(record.nameOffset, record.nameLength) = addString(entry.name);
+                std::tie(record.keyOffset, record.keyLength) = addString(entry.key);
+                std::memcpy(bytes_.data() + offset, &record, sizeof(record));
+                offset += sizeof(Record);
+            }
+        }
+        FileHeader header{Magic, ByteOrderMark, FormatVersion, bytes_.size(), headers_};
+        std::memcpy(bytes_.data(), &header, sizeof(header));
+        return bytes_;
+    }
+
+private:
+    auto addArray(const std::vector<uint32_t>& values) -> uint32_t {
+        const auto offset = static_cast<uint32_t>(bytes_.size());
+        bytes_.resize(bytes_.size() + values.size() * sizeof(uint32_t));
+        if (!values.empty()) {
+            std::memcpy(bytes_.data() + offset, values.data(), values.size() * sizeof(uint32_t));
+        }
+        return offset;
+    }
+
+    auto addIndex(const PerfectHash::Index& index) -> IndexHeader {
+        IndexHeader header{static_cast<uint32_t>(index.seeds.size()), static_cast<uint32_t>(index.slots.size()), 0, 0};
+        header.seedsOffset = addArray(index.seeds);
+        header.slotsOffset = addArray(index.slots);
+        return header;
+    }
+
+    auto addString(const std::string& value) -> std::pair<uint32_t, uint32_t> {
+        const auto offset = static_cast<uint32_t>(bytes_.size());
+        bytes_.insert(bytes_.end(), value.begin(), value.end());
+        return {offset, static_cast<uint32_t>(value.size())};
+    }
+
+    std::vector<uint8_t> bytes_;
+    std::array<TableHeader, TableCount> headers_{};
+    std::vector<std::pair<Table, const std::vector<Entry>*>> pending_;
+};
+
+auto header(const uint8_t* data) -> const FileHeader& {
+    return *reinterpret_cast<const FileHeader*>(data);
+}
+
+/**
+ * Whether an array of count elements of the given size lies inside the file, 4 byte aligned.
+ */
+auto inFile(uint64_t offset, uint64_t count, uint64_t element_size, std::size_t size) -> bool {
+    return 0 == offset % alignof(uint32_t) && offset <= size && count * element_size <= size - offset;
+}
+
+auto isValidIndex(const IndexHeader& index, uint32_t count, std::size_t size) -> bool {
+    if (0 == count) {
+        return true;
+    }
+    return 0 != index.buckets && count < index.slots && inFile(index.seedsOffset, index.buckets, sizeof(uint32_t), size) &&
+           inFile(index.slotsOffset, index.slots, sizeof(uint32_t), size);
+}
+
+/**
+ * Check the header and that every table and index lies inside the file.
+ * Records are checked when they are read, so this does not depend on the size of the catalogue.
+ */
+auto isValid(const uint8_t* data, std::size_t size) -> bool {
+    if (size < sizeof(FileHeader)) {
+        return false;
+    }
+    const auto& file = header(data);
+    if (Magic != file.magic || ByteOrderMark != file.byteOrder || FormatVersion != file.version || size != file.size) {
+        return false;
+    }
+    return std::all_of(file.tables.begin(), file.tables.end(), [size](const auto& table) {
+        return inFile(table.recordsOffset, table.count, sizeof(Record), size) &&
+               isValidIndex(table.byName, table.count, size) && isValidIndex(table.byId, table.count, size);
+    });
+}
+
+/**
+ * Position of the record a key hashes to in a table.
+ * @param hash_of Called as hash_of(seed), returns the hash of the key.
+ * @return nullptr if no record has the slot of the key, the caller compares the key.
+ */
+template <typename HashOf>
+auto findRecord(const uint8_t* data, Table table, bool by_name, HashOf&& hash_of) -> const Record* {
+    const auto& info = header(data).tables[table];
+    if (0 == info.count) {
+        return nullptr;
+    }
+    const auto& index = by_name ? info.byName : info.byId;
+    const auto* seeds = reinterpret_cast<const uint32_t*>(data + index.seedsOffset);
+    const auto* slots = reinterpret_cast<const uint32_t*>(data + index.slotsOffset);
+    const auto position = slots[PerfectHash::slotOf(seeds, index.buckets, index.slots, hash_of)];
+    if (position >= info.count) {
+        return nullptr;
+    }
+    return reinterpret_cast<const Record*>(data + info.recordsOffset) + position;
+}
+
+auto stringAt(const uint8_t* data, std::size_t size, uint32_t offset, uint32_t length) -> std::string_view {
+    if (offset > size || length > size - offset) {
+        return {};
+    }
+    return {reinterpret_cast<const char*>(data + offset), length};
+}
+
+auto lowercase(std::string value) -> std::string {
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+    return value;
+}
+
+} // namespace
+
+auto UriCatalogue::write(const std::string& path,
+                         const std::vector<EntityMapping>& entities,
+                         const std::vector<ResourceMapping>& resources,
+                         const std::vector<AuthorityMapping>& authorities) -> bool {
+    std::vector<Entry> authority_entries;
+    for (const auto& authority : authorities) {
+        authority_entries.push_back({0, 0, lowercase(authority.name), authority.id});
+    }
+    std::vector<Entry> entity_entries;
+    for (const auto& entity : entities) {
+        entity_entries.push_back({0, entity.id, entity.name, {}});
+    }
+    authority_entries = dedup(Authorities, std::move(authority_entries));
+    entity_entries = dedup(Entities, std::move(entity_entries));
+
+    std::unordered_set<uint32_t> entity_ids;
+    for (const auto& entity : entity_entries) {
+        entity_ids.insert(entity.id);
+    }
+    std::vector<Entry> resource_entries;
+    for (const auto& resource : resources) {
+        if (entity_ids.count(resource.entityId) != 0) {
+            resource_entries.push_back({resource.entityId, resource.id, resource.resource, {}});
+        }
+    }
+    resource_entries = dedup(Resources, std::move(resource_entries));
+
+    Writer writer;
+    writer.addTable(Authorities, authority_entries);
+    writer.addTable(Entities, entity_entries);
+    writer.addTable(Resources, resource_entries);
+    const auto& bytes = writer.finish();
+    if (bytes.size() > std::numeric_limits<uint32_t>::max()) {
+        spdlog::error("URI catalogue is too large: {} bytes", bytes.size());
+        return false;
+    }
+
+    // write next to the file and rename, so processes mapping the old file keep a complete one
+    const auto tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!out.flush()) {
+            spdlog::error("Cannot write URI catalogue {}", tmp_path);
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (0 != std::rename(tmp_path.c_str(), path.c_str())) {
+        spdlog::error("Cannot replace URI catalogue {}", path);
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+auto UriCatalogue::open(const std::string& path) -> std::shared_ptr<const UriCatalogue> {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        spdlog::error("Cannot open URI catalogue {}", path);
+        return nullptr;
+    }
+    struct stat info {};
+    if (0 != ::fstat(fd, &info) || info.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        spdlog::error("URI catalogue {} is too short", path);
+        ::close(fd);
+        return nullptr;
+    }
+    const auto size = static_cast<std::size_t>(info.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == data) {
+        spdlog::error("Cannot map URI catalogue {}", path);
+        return nullptr;
+    }
+    if (!isValid(static_cast<const uint8_t*>(data), size)) {
+        spdlog::error("{} is not a URI catalogue", path);
+        ::munmap(data, size);
+        return nullptr;
+    }
+    return std::shared_ptr<const UriCatalogue>(new UriCatalogue(static_cast<const uint8_t*>(data), size));
+}
+
+UriCatalogue::UriCatalogue(const uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+
+UriCatalogue::~UriCatalogue() {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+}
+
+auto UriCatalogue::resolve(std::string_view entity) const -> std::optional<uint32_t> {
+    const auto* record =
+        findRecord(data_, Entities, true, [entity](uint32_t seed) { return nameHash(entity, 0, seed); });
+    if (nullptr == record || stringAt(data_, size_, record->nameOffset, record->nameLength) != entity) {
+        return std::nullopt;
+    }
+    return record->id;
+}
+
+auto UriCatalogue::resolve(uint32_t entity_id, std::string_view resource) const -> std::optional<uint32_t> {
+    const auto key = resourceKey(resource);
+    const auto* record = findRecord(data_, Resources, true,
+                                    [key, entity_id](uint32_t seed) { return nameHash(key, entity_id, seed); });
+    if (nullptr == record || record->scope != entity_id ||
+        resourceKey(stringAt(data_, size_, record->nameOffset, record->nameLength)) != key) {
+        return std::nullopt;
+    }
+    return record->id;
+}
+
+auto UriCatalogue::reverse(uint32_t entity_id) const -> std::string_view {
+    const auto* record =
+        findRecord(data_, Entities, false, [entity_id](uint32_t seed) { return idHash(0, entity_id, seed); });
+    if (nullptr == record || record->id != entity_id) {
+        return {};
+    }
+    return stringAt(data_, size_, record->nameOffset, record->nameLength);
+}
+
+auto UriCatalogue::reverse(uint32_t entity_id, uint32_t resource_id) const -> std::string_view {
+    const auto* record = findRecord(data_, Resources, false, [entity_id, resource_id](uint32_t seed) {
+        return idHash(entity_id, resource_id, seed);
+    });
+    if (nullptr == record || record->scope != entity_id || record->id != resource_id) {
+        return {};
+    }
+    return stringAt(data_, size_, record->nameOffset, record->nameLength);
+}
+
+auto UriCatalogue::resolveAuthority(std::string_view name) const -> std::string_view {
+    const auto* record =
+        findRecord(data_, Authorities, true, [name](uint32_t seed) { return nameHash(name, 0, seed); });
+    if (nullptr == record || stringAt(data_, size_, record->nameOffset, record->nameLength) != name) {
+        return {};
+    }
+    return stringAt(data_, size_, record->keyOffset, record->keyLength);
+}
+
+auto UriCatalogue::reverseAuthority(std::string_view id) const -> std::string_view {
+    const auto* record = findRecord(data_, Authorities, false, [id](uint32_t seed) { return nameHash(id, 0, seed); });
+    if (nullptr == record || stringAt(data_, size_, record->keyOffset, record->keyLength) != id) {
+        return {};
+    }
+    return stringAt(data_, size_, record->nameOffset, record->nameLength);
+}
+
+auto UriCatalogue::resolve(const v1::UAuthority& authority) const -> v1::UAuthority {
+    if (isLocal(authority)) {
+        return authority;
+    }
+    const bool has_name = authority.has_name() && !authority.name().empty();
+    const bool has_id = authority.has_id() && !authority.id().empty();
+    if (has_name && !has_id) {
+        if (const auto id = resolveAuthority(authority.name()); !id.empty()) {
+            // set the id directly, BuildUAuthority::setId() stops at the first zero byte
+            auto resolved = BuildUAuthority().setName(authority.name()).build();
+            resolved.set_id(std::string(id));
+            return resolved;
+        }
+    } else if (has_id && !has_name) {
+        if (const auto name = reverseAuthority(authority.id()); !name.empty()) {
+            auto resolved = BuildUAuthority().setName(std::string(name)).build();
+            resolved.set_id(authority.id());
+            return resolved;
+        }
+    }
+    return authority;
+}
+
+auto UriCatalogue::resolve(const v1::UEntity& entity) const -> v1::UEntity {
+    const bool has_id = entity.has_id() && 0 != entity.id();
+    std::optional<uint32_t> id;
+    std::string_view name;
+    if (!isBlank(entity.name()) && !has_id) {
+        id = resolve(entity.name());
+        name = entity.name();
+    } else if (isBlank(entity.name()) && has_id) {
+        id = entity.id();
+        name = reverse(entity.id());
+    }
+    if (!id || name.empty()) {
+        return entity;
+    }
+    BuildUEntity builder;
+    builder.setName(std::string(name)).setId(*id);
+    if (entity.has_version_major()) {
+        builder.setMajorVersion(entity.version_major());
+    }
+    if (entity.has_version_minor()) {
+        builder.setMinorVersion(entity.version_minor());
+    }
+    return builder.build();
+}
+
+auto UriCatalogue::resolve(const v1::UResource& resource, uint32_t entity_id) const -> v1::UResource {
+    const bool has_id = resource.has_id() && 0 != resource.id();
+    if (!isBlank(resource.name()) && !has_id) {
+        auto key = resource.name();
+        if (!resource.instance().empty()) {
+            key.append(".").append(resource.instance());
+        }
+        if (const auto id = resolve(entity_id, key)) {
+            auto resolved = resource;
+            resolved.set_id(*id);
+            return resolved;
+        }
+    } else if (isBlank(resource.name()) && has_id) {
+        const auto long_form = reverse(entity_id, resource.id());
+        if (long_form.empty()) {
+            return resource;
+        }
+        const auto key = resourceKey(long_form);
+        const auto dot = key.find('.');
+        BuildUResource builder;
+        builder.setName(std::string(key.substr(0, dot))).setID(resource.id());
+        if (dot != std::string_view::npos) {
+            builder.setInstance(std::string(key.substr(dot + 1)));
+        }
+        if (key.size() < long_form.size()) {
+            builder.setMessage(std::string(long_form.substr(key.size() + 1)));
+        }
+        return builder.build();
+    }
+    return resource;
+}
+
+auto UriCatalogue::resolve(const v1::UUri& uri) const -> v1::UUri {
+    auto resolved = uri;
+    if (uri.has_authority()) {
+        *resolved.mutable_authority() = resolve(uri.authority());
+    }
+    if (uri.has_entity()) {
+        *resolved.mutable_entity() = resolve(uri.entity());
+    }
+    if (resolved.entity().has_id() && 0 != resolved.entity().id() && uri.has_resource()) {
+        *resolved.mutable_resource() = resolve(uri.resource(), resolved.entity().id());
+    }
+    return resolved;
+}
+
+auto UriCatalogue::entityCount() const -> std::size_t {
+    return header(data_).tables[Entities].count;
+}
+
+auto UriCatalogue::resourceCount() const -> std::size_t {
+    return header(data_).tables[Resources].count;
+}
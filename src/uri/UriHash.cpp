@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <up-cpp/uri/tools/UriHash.h>
+#include "LongUriWriter.h"
+
+using namespace uprotocol::uri;
+using namespace uprotocol::uri::longform;
+
+namespace {
+
+/**
+ * Sink computing the 64 bit FNV-1a hash of what is written to it.
+ */
+class HashSink {
+public:
+    auto append(std::string_view str) -> void {
+        for (const auto ch : str) {
+            hash_ = (hash_ ^ static_cast<unsigned char>(ch)) * Prime;
+        }
+    }
+
+    /**
+     * Mix a numeric field, tagged so that different fields do not cancel out.
+     */
+    auto mix(char tag, uint32_t value) -> void {
+        const char bytes[] = {tag,
+                              static_cast<char>(value), static_cast<char>(value >> 8),
+                              static_cast<char>(value >> 16), static_cast<char>(value >> 24)};
+        append(std::string_view(bytes, sizeof(bytes)));
+    }
+
+    [[nodiscard]] auto hash() const -> std::size_t { return static_cast<std::size_t>(hash_); }
+
+private:
+    static constexpr uint64_t Prime = 0x100000001b3ULL;
+    uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+
+/**
+ * Sink comparing what is written to it with an expected string.
+ */
+class CompareSink {
+public:
+    explicit CompareSink(std::string_view expected) : expected_(expected) {}
+
+    auto append(std::string_view str) -> void {
+        if (equal_) {
+            equal_ = expected_.substr(0, str.size()) == str;
+            expected_.remove_prefix(std::min(str.size(), expected_.size()));
+        }
+    }
+
+    /**
+     * @return true if exactly the expected string was written.
+     */
+    [[nodiscard]] auto matches() const -> bool { return equal_ && expected_.empty(); }
+
+private:
+    std::string_view expected_;
+    bool equal_ = true;
+};
+
+/**
+ * The micro form fields of each part are not written by the long format,
+ * they are mixed in after it. A part without them hashes like its long format.
+ */
+auto mixMicroFields(HashSink& sink, const uprotocol::v1::UAuthority& authority) -> void {
+    if (!authority.ip().empty()) {
+        sink.append("\x01");
+        sink.append(authority.ip());
+    }
+    if (!authority.id().empty()) {
+        sink.append("\x02");
+        sink.append(authority.id());
+    }
+}
+
+auto mixMicroFields(HashSink& sink, const uprotocol::v1::UEntity& entity) -> void {
+    if (entity.has_id()) {
+        sink.mix('\x03', entity.id());
+    }
+}
+
+auto mixMicroFields(HashSink& sink, const uprotocol::v1::UResource& resource) -> void {
+    if (resource.has_id()) {
+        sink.mix('\x04', resource.id());
+    }
+}
+
+auto hasMicroFields(const uprotocol::v1::UUri& uri) -> bool {
+    return !uri.authority().ip().empty() || !uri.authority().id().empty() ||
+           uri.entity().has_id() || uri.resource().has_id();
+}
+
+/**
+ * Equality of optional numeric fields: both unset, or both set to the same value.
+ */
+template <typename Message, typename Has, typename Get>
+auto sameOptional(const Message& lhs, const Message& rhs, Has has, Get get) -> bool {
+    return (lhs.*has)() == (rhs.*has)() && (lhs.*get)() == (rhs.*get)();
+}
+
+} // namespace
+
+auto UriHash::operator()(const v1::UUri& uri) const -> std::size_t {
+    HashSink sink;
+    writeUri(sink, uri);
+    mixMicroFields(sink, uri.authority());
+    mixMicroFields(sink, uri.entity());
+    mixMicroFields(sink, uri.resource());
+    return sink.hash();
+}
+
+auto UriHash::operator()(std::string_view long_uri) const -> std::size_t {
+    HashSink sink;
+    sink.append(long_uri);
+    return sink.hash();
+}
+
+auto UriHash::operator()(const v1::UAuthority& authority) const -> std::size_t {
+    HashSink sink;
+    writeAuthority(sink, authority);
+    mixMicroFields(sink, authority);
+    return sink.hash();
+}
+
+auto UriHash::operator()(const v1::UEntity& entity) const -> std::size_t {
+    HashSink sink;
+    writeEntity(sink, entity);
+    mixMicroFields(sink, entity);
+    return sink.hash();
+}
+
+auto UriHash::operator()(const v1::UResource& resource) const -> std::size_t {
+    HashSink sink;
+    writeResource(sink, resource);
+    mixMicroFields(sink, resource);
+    return sink.hash();
+}
+
+auto UriEqual::operator()(const v1::UUri& lhs, const v1::UUri& rhs) const -> bool {
+    return (*this)(lhs.authority(), rhs.authority()) &&
+           (*this)(lhs.entity(), rhs.entity()) &&
+           (*this)(lhs.resource(), rhs.resource());
+}
+
+/**
+ * Compare a UUri with a long format string, without serializing the UUri.
+ */
+auto UriEqual::operator()(const v1::UUri& lhs, std::string_view rhs) const -> bool {
+    if (hasMicroFields(lhs)) {
+        return false;
+    }
+    CompareSink sink(rhs);
+    writeUri(sink, lhs);
+    return sink.matches();
+}
+
+auto UriEqual::operator()(const v1::UAuthority& lhs, const v1::UAuthority& rhs) const -> bool {
+    return lhs.name() == rhs.name() && lhs.ip() == rhs.ip() && lhs.id() == rhs.id();
+}
+
+auto UriEqual::operator()(const v1::UEntity& lhs, const v1::UEntity& rhs) const -> bool {
+    using v1::UEntity;
+    return lhs.name() == rhs.name() &&
+           sameOptional(lhs, rhs, &UEntity::has_id, &UEntity::id) &&
+           sameOptional(lhs, rhs, &UEntity::has_version_major, &UEntity::version_major) &&
+           sameOptional(lhs, rhs, &UEntity::has_version_minor, &UEntity::version_minor);
+}
+
+auto UriEqual::operator()(const v1::UResource& lhs, const v1::UResource& rhs) const -> bool {
+    using v1::UResource;
+    return lhs.name() == rhs.name() && lhs.instance() == rhs.instance() &&
+           lhs.message() == rhs.message() &&
+           sameOptional(lhs, rhs, &UResource::has_id, &UResource::id);
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <mutex>
+#include <up-cpp/uri/registry/UriRegistry.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+#include <up-cpp/uri/tools/Utils.h>
+#include <up-cpp/uri/validator/LongUriValidator.h>
+
+using namespace uprotocol::uri;
+
+auto UriRegistry::global() -> UriRegistry& {
+    static UriRegistry registry;
+    return registry;
+}
+
+UriRegistry::~UriRegistry() {
+    for (auto &segment : segments_) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Intern a URI. Known URIs only take the shared lock.
+ * @param uri URI to intern.
+ * @return Returns the handle of the URI.
+ */
+auto UriRegistry::intern(const v1::UUri& uri) -> UriHandle {
+    if (isEmpty(uri)) {
+        return {};
+    }
+    // proto3 messages without maps always encode their fields in the same order
+    auto key = uri.SerializeAsString();
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (auto it = byKey_.find(key); it != byKey_.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (auto it = byKey_.find(key); it != byKey_.end()) {
+        return it->second;
+    }
+    return append(std::move(key), uri);
+}
+
+/**
+ * Intern a long format URI. The string is mapped to the handle of the UUri
+ * it deserializes to, so it is parsed once however often it is interned.
+ * Invalid strings are rejected by LongUriValidator before deserializing, as
+ * some of them make LongUriSerializer::deserialize throw. Once MaxAliases
+ * aliases are recorded, further aliases are deserialized on every call.
+ * @param long_uri A long format uProtocol URI.
+ * @return Returns the handle of the URI.
+ */
+auto UriRegistry::intern(std::string_view long_uri) -> UriHandle {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (auto it = byLongUri_.find(long_uri); it != byLongUri_.end()) {
+            return it->second;
+        }
+    }
+
+    if (!LongUriValidator::isValid(long_uri)) {
+        return {};
+    }
+    auto handle = intern(LongUriSerializer::deserialize(long_uri));
+    if (!handle.isValid()) {
+        return handle;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (auto it = byLongUri_.find(long_uri); it != byLongUri_.end()) {
+        return it->second;
+    }
+    const auto *entry = lookup(handle);
+    std::string_view key = entry->longUri;
+    if (key != long_uri) {
+        if (aliases_.size() >= MaxAliases) {
+            return handle;
+        }
+        key = aliases_.emplace_back(long_uri);
+    }
+    byLongUri_.emplace(key, handle);
+    return handle;
+}
+
+auto UriRegistry::find(const v1::UUri& uri) const -> UriHandle {
+    if (isEmpty(uri)) {
+        return {};
+    }
+    auto key = uri.SerializeAsString();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (auto it = byKey_.find(key); it != byKey_.end()) {
+        return it->second;
+    }
+    return {};
+}
+
+/**
+ * Resolve a handle. Entries below size_ are never modified, and size_ is
+ * published after the entry, so no lock is needed.
+ * @param handle Handle returned by this registry.
+ * @return Returns the interned entry, or nullptr.
+ */
+auto UriRegistry::lookup(UriHandle handle) const -> const Entry* {
+    const std::size_t value = handle.value();
+    if (0 == value || value > size_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    const auto index = value - 1;
+    return &segments_[index / SegmentSize].load(std::memory_order_acquire)[index % SegmentSize];
+}
+
+auto UriRegistry::uri(UriHandle handle) const -> const v1::UUri& {
+    static const v1::UUri empty;
+    const auto *entry = lookup(handle);
+    return nullptr == entry ? empty : entry->uri;
+}
+
+auto UriRegistry::longUri(UriHandle handle) const -> std::string_view {
+    const auto *entry = lookup(handle);
+    return nullptr == entry ? std::string_view() : std::string_view(entry->longUri);
+}
+
+auto UriRegistry::microUri(UriHandle handle) const -> const std::vector<uint8_t>& {
+    static const std::vector<uint8_t> empty;
+    const auto *entry = lookup(handle);
+    return nullptr == entry ? empty : entry->microUri;
+}
+
+/**
+ * Append an entry and publish it to lookup().
+ * @param key Canonical key of the URI.
+ * @param uri URI to intern.
+ * @return Returns the handle of the new entry.
+ */
+auto UriRegistry::append(std::string key, const v1::UUri& uri) -> UriHandle {
+    const auto index = size_.load(std::memory_order_relaxed);
+    if (index >= MaxSize) {
+        return {};
+    }
+    auto &segment = segments_[index / SegmentSize];
+    auto *entries = segment.load(std::memory_order_relaxed);
+    if (nullptr == entries) {
+        entries = new Entry[SegmentSize];
+        segment.store(entries, std::memory_order_release);
+    }
+
+    auto &entry = entries[index % SegmentSize];
+    entry.uri = uri;
+    entry.longUri = LongUriSerializer::serialize(uri);
+    if (isMicroForm(uri)) {
+        entry.microUri = MicroUriSerializer::serialize(uri);
+    }
+
+    const UriHandle handle(static_cast<uint32_t>(index + 1));
+    byKey_.emplace(std::move(key), handle);
+    size_.store(index + 1, std::memory_order_release);
+    return handle;
+}
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <up-cpp/uri/resolver/UriResolver.h>
+#include <up-cpp/uri/serializer/IpAddress.h>
+#include <up-cpp/uri/serializer/UriTokenizer.h>
+
+using namespace uprotocol::uri;
+using AddressType = IpAddress::AddressType;
+
+namespace {
+
+/** Micro URI format version */
+constexpr uint8_t UpVersion = 0x01;
+/** Length of a micro URI without authority address */
+constexpr std::size_t LocalMicroUriLength = 8;
+/** Longest authority name or id */
+constexpr std::size_t MaxAuthorityLength = 255;
+
+/**
+ * Resource name and instance, without the message.
+ */
+auto resourceKey(std::string_view resource) -> std::string_view {
+    return resource.substr(0, resource.find('#'));
+}
+
+/**
+ * Major version of a long format version, "2" or "2.7". An empty version is 0.
+ * @return false if the version is not a number or does not fit the micro format.
+ */
+auto parseMajorVersion(std::string_view version, uint8_t& major) -> bool {
+    if (version.empty()) {
+        major = 0;
+        return true;
+    }
+    const auto digits = version.substr(0, version.find('.'));
+    unsigned value = 0;
+    auto result = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+    if (result.ec != std::errc() || result.ptr != digits.data() + digits.size() || value > 0xFF) {
+        return false;
+    }
+    major = static_cast<uint8_t>(value);
+    return true;
+}
+
+/**
+ * Micro address of an authority: address type, then the address bytes.
+ */
+auto microAddress(const std::string& address) -> std::string {
+    IpAddress ip(address);
+    if (AddressType::IpV4 == ip.getType() || AddressType::IpV6 == ip.getType()) {
+        std::string micro(1, static_cast<char>(ip.getType()));
+        micro.append(reinterpret_cast<const char*>(ip.data()), ip.size());
+        return micro;
+    }
+    return static_cast<char>(AddressType::Id) + address;
+}
+
+auto lowercase(std::string str) -> std::string {
+    std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return std::tolower(c); });
+    return str;
+}
+
+} // namespace
+
+/**
+ * Build the resolution tables.
+ * @param entities Entity names and ids.
+ * @param resources Resource names and ids.
+ * @param authorities Remote authority names and addresses.
+ */
+UriResolver::UriResolver(const std::vector<EntityMapping>& entities,
+                         const std::vector<ResourceMapping>& resources,
+                         const std::vector<AuthorityMapping>& authorities) {
+    std::vector<std::pair<std::string, uint32_t>> by_name;
+    std::vector<std::pair<uint32_t, uint32_t>> by_id;
+    for (const auto& entity : entities) {
+        const auto index = static_cast<uint32_t>(entities_.size());
+        by_name.emplace_back(entity.name, index);
+        by_id.emplace_back(entity.id, index);
+        entities_.push_back(Entity{entity.name, entity.id, {}, {}});
+    }
+    entitiesByName_ = PerfectHashMap<std::string, uint32_t>(std::move(by_name));
+    entitiesById_ = PerfectHashMap<uint32_t, uint32_t>(std::move(by_id));
+
+    std::vector<std::vector<std::pair<std::string, uint16_t>>> resource_ids(entities_.size());
+    std::vector<std::vector<std::pair<uint32_t, std::string>>> resource_names(entities_.size());
+    for (const auto& resource : resources) {
+        const auto* index = entitiesById_.find(resource.entityId);
+        if (nullptr == index) {
+            continue;
+        }
+        resource_ids[*index].emplace_back(std::string(resourceKey(resource.resource)), resource.id);
+        resource_names[*index].emplace_back(resource.id, resource.resource);
+    }
+    for (std::size_t i = 0; i < entities_.size(); ++i) {
+        entities_[i].resourceIds = PerfectHashMap<std::string, uint16_t>(std::move(resource_ids[i]));
+        entities_[i].resources = PerfectHashMap<uint32_t, std::string>(std::move(resource_names[i]));
+    }
+
+    std::vector<std::pair<std::string, std::string>> addresses;
+    std::vector<std::pair<std::string, std::string>> names;
+    for (const auto& authority : authorities) {
+        if (authority.address.empty()) {
+            continue;
+        }
+        auto name = lowercase(authority.name);
+        auto address = microAddress(authority.address);
+        if (name.empty() || name.size() > MaxAuthorityLength || address.size() > MaxAuthorityLength + 1) {
+            continue;
+        }
+        addresses.emplace_back(name, address);
+        names.emplace_back(std::move(address), std::move(name));
+    }
+    addresses_ = PerfectHashMap<std::string, std::string>(std::move(addresses));
+    authorities_ = PerfectHashMap<std::string, std::string>(std::move(names));
+}
+
+/**
+ * Transcode a long format URI to the micro format. The URI is split as
+ * LongUriSerializer::deserialize does.
+ * @param long_uri A long format uProtocol URI.
+ * @param micro_uri Replaced with the micro format.
+ * @return false if the URI cannot be resolved.
+ */
+auto UriResolver::toMicro(std::string_view long_uri, std::vector<uint8_t>& micro_uri) const -> bool {
+    micro_uri.clear();
+    const UriTokenizer parts(long_uri);
+    if (long_uri.empty() || parts.size() < 2 || parts.firstNotEmpty() > 3) {
+        return false;
+    }
+
+    const std::string* address = nullptr;
+    std::size_t first = parts.firstNotEmpty();
+    if (!parts.isLocal()) {
+        const auto authority = parts[first];
+        if (parts.size() < 4 || authority.size() > MaxAuthorityLength) {
+            return false;
+        }
+        std::array<char, MaxAuthorityLength> name{};
+        std::transform(authority.begin(), authority.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        address = addresses_.find(std::string_view(name.data(), authority.size()));
+        if (nullptr == address) {
+            return false;
+        }
+        ++first;
+    }
+
+    const auto* entity_index = entitiesByName_.find(parts[first]);
+    if (nullptr == entity_index) {
+        return false;
+    }
+    const auto& entity = entities_[*entity_index];
+    uint8_t version = 0;
+    if (!parseMajorVersion(parts[first + 1], version)) {
+        return false;
+    }
+    const auto* resource_id = entity.resourceIds.find(resourceKey(parts[first + 2]));
+    if (nullptr == resource_id) {
+        return false;
+    }
+
+    // local authorities get the address type MicroUriSerializer::serialize gives them
+    const auto address_type = nullptr == address ? static_cast<uint8_t>(AddressType::Invalid)
+                                                 : static_cast<uint8_t>((*address)[0]);
+    micro_uri.resize(LocalMicroUriLength);
+    micro_uri[0] = UpVersion;
+    micro_uri[1] = address_type;
+    micro_uri[2] = static_cast<uint8_t>(*resource_id >> 8);
+    micro_uri[3] = static_cast<uint8_t>(*resource_id);
+    micro_uri[4] = static_cast<uint8_t>(entity.id >> 8);
+    micro_uri[5] = static_cast<uint8_t>(entity.id);
+    micro_uri[6] = version;
+    micro_uri[7] = 0;
+    if (nullptr != address) {
+        if (static_cast<uint8_t>(AddressType::Id) == address_type) {
+            micro_uri.push_back(static_cast<uint8_t>(address->size() - 1));
+        }
+        micro_uri.insert(micro_uri.end(), address->begin() + 1, address->end());
+    }
+    return true;
+}
+
+auto UriResolver::toMicro(std::string_view long_uri) const -> std::vector<uint8_t> {
+    std::vector<uint8_t> micro_uri;
+    toMicro(long_uri, micro_uri);
+    return micro_uri;
+}
+
+/**
+ * Transcode a micro format URI to the long format.
+ * @param micro_uri The micro format URI.
+ * @param size Number of bytes of micro_uri.
+ * @param long_uri Replaced with the long format.
+ * @return false if the URI cannot be resolved.
+ */
+auto UriResolver::toLong(const uint8_t* micro_uri, std::size_t size, std::string& long_uri) const -> bool {
+    long_uri.clear();
+    if (nullptr == micro_uri || size < LocalMicroUriLength || UpVersion != micro_uri[0]) {
+        return false;
+    }
+
+    const std::string* authority = nullptr;
+    const auto type = static_cast<AddressType>(micro_uri[1]);
+    std::size_t address_start = LocalMicroUriLength;
+    std::size_t address_size = 0;
+    switch (type) {
+        case AddressType::Local:
+        case AddressType::Invalid:
+            break;
+        case AddressType::IpV4:
+            address_size = IpAddress::IpV4AddressBytes;
+            break;
+        case AddressType::IpV6:
+            address_size = IpAddress::IpV6AddressBytes;
+            break;
+        case AddressType::Id:
+            // an empty id would otherwise be read as a local URI
+            if (size == LocalMicroUriLength || 0 == micro_uri[LocalMicroUriLength]) {
+                return false;
+            }
+            address_start = LocalMicroUriLength + 1;
+            address_size = micro_uri[LocalMicroUriLength];
+            break;
+        default:
+            return false;
+    }
+    if (size != address_start + address_size) {
+        return false;
+    }
+    if (0 != address_size) {
+        std::array<char, MaxAuthorityLength + 1> address{};
+        address[0] = static_cast<char>(type);
+        std::copy(micro_uri + address_start, micro_uri + size, address.begin() + 1);
+        authority = authorities_.find(std::string_view(address.data(), address_size + 1));
+        if (nullptr == authority) {
+            return false;
+        }
+    }
+
+    const auto resource_id = static_cast<uint16_t>((micro_uri[2] << 8) | micro_uri[3]);
+    const auto entity_id = static_cast<uint16_t>((micro_uri[4] << 8) | micro_uri[5]);
+    const auto* entity_index = entitiesById_.find(entity_id);
+    if (nullptr == entity_index) {
+        return false;
+    }
+    const auto& entity = entities_[*entity_index];
+    const auto* resource = entity.resources.find(resource_id);
+    if (nullptr == resource) {
+        return false;
+    }
+
+    std::array<char, 3> version{};
+    auto result = std::to_chars(version.data(), version.data() + version.size(), micro_uri[6]);
+    if (nullptr != authority) {
+        long_uri.append("//").append(*authority);
+    }
+    long_uri.append("/").append(entity.name).append("/");
+    long_uri.append(version.data(), result.ptr);
+    long_uri.append("/").append(*resource);
+    return true;
+}
+
+auto UriResolver::toLong(const std::vector<uint8_t>& micro_uri) const -> std::string {
+    std::string long_uri;
+    toLong(micro_uri.data(), micro_uri.size(), long_uri);
+    return long_uri;
+}
+
+auto UriResolver::entityId(std::string_view name) const -> const uint16_t* {
+    const auto* index = entitiesByName_.find(name);
+    return nullptr == index ? nullptr : &entities_[*index].id;
+}
+
+auto UriResolver::resourceId(uint16_t entity_id, std::string_view resource) const -> const uint16_t* {
+    const auto* index = entitiesById_.find(entity_id);
+    return nullptr == index ? nullptr : entities_[*index].resourceIds.find(resourceKey(resource));
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <up-cpp/uuid/dedup/IdDeduplicator.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+
+namespace uprotocol::uuid {
+
+IdDeduplicator::IdDeduplicator(std::chrono::milliseconds window,
+                               std::size_t capacity) : window_(window.count()) {
+    std::size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    ringMask_ = size - 1;
+    ring_.resize(size);
+    // 2 slots per id, so the filter is at most half full
+    auto buckets = std::max<std::size_t>(1, 2 * size / SlotsPerBucket);
+    bucketMask_ = buckets - 1;
+    slots_ = std::make_unique<std::atomic<uint32_t>[]>(buckets * SlotsPerBucket);
+    for (std::size_t i = 0; i < buckets * SlotsPerBucket; ++i) {
+        slots_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+IdDeduplicator::Result IdDeduplicator::insert(const RawUuid &id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto window = static_cast<uint64_t>(window_.load(std::memory_order_relaxed));
+    auto now = Uuidv8Factory::now();
+    while (head_ != tail_ && now - std::min(now, ring_[head_ & ringMask_].arrival) > window) {
+        evictOldest();
+    }
+
+    if (contains(id)) {
+        duplicates_.fetch_add(1, std::memory_order_relaxed);
+        return Result::Duplicate;
+    }
+    // an id from the future is clamped to now, it can not expire others
+    auto result = Result::New;
+    if (now - std::min(now, id.getTime()) > window) {
+        expired_.fetch_add(1, std::memory_order_relaxed);
+        result = Result::Expired;
+    }
+    if (tail_ - head_ == capacity()) {
+        evictOldest();
+    }
+    auto k = key(id);
+    while (!add(k)) {
+        evictOldest();
+    }
+    ring_[tail_++ & ringMask_] = Entry{id, now};
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return result;
+}
+
+bool IdDeduplicator::contains(const RawUuid &id) const {
+    auto k = key(id);
+    for (;;) {
+        auto moves = moves_.load(std::memory_order_acquire);
+        for (auto bucket : {k.bucket1, k.bucket2}) {
+            auto *slots = &slots_[bucket * SlotsPerBucket];
+            for (std::size_t i = 0; i < SlotsPerBucket; ++i) {
+                if (k.fingerprint == slots[i].load(std::memory_order_acquire)) {
+                    return true;
+                }
+            }
+        }
+        // a fingerprint moved from the second bucket to the first one behind
+        // the scan would have been missed: scan again
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (0 == (moves & 1) && moves == moves_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+    }
+}
+
+void IdDeduplicator::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < (bucketMask_ + 1) * SlotsPerBucket; ++i) {
+        slots_[i].store(0, std::memory_order_relaxed);
+    }
+    head_ = tail_ = 0;
+    size_.store(0, std::memory_order_relaxed);
+}
+
+double IdDeduplicator::falsePositiveRate() const {
+    // each lookup compares the fingerprint with the filled slots of 2 buckets
+    auto load = static_cast<double>(size()) / ((bucketMask_ + 1) * SlotsPerBucket);
+    auto compared = 2 * SlotsPerBucket * load;
+    return -std::expm1(compared * std::log1p(-1.0 / UINT32_MAX));
+}
+
+IdDeduplicator::Key IdDeduplicator::key(const RawUuid &id) const {
+    auto hash = static_cast<uint64_t>(hashUuid(id.msb, id.lsb));
+    auto fingerprint = static_cast<uint32_t>(hash >> 32);
+    if (0 == fingerprint) {
+        fingerprint = 1;
+    }
+    auto bucket = hash & bucketMask_;
+    return Key{fingerprint, bucket, altBucket(bucket, fingerprint)};
+}
+
+std::size_t IdDeduplicator::altBucket(std::size_t bucket,
+                                      uint32_t fingerprint) const {
+    // partial key cuckoo hashing: each bucket is the alternate of the other
+    return (bucket ^ (fingerprint * 0x5bd1e995ULL)) & bucketMask_;
+}
+
+bool IdDeduplicator::add(const Key &k) {
+    for (auto bucket : {k.bucket1, k.bucket2}) {
+        for (std::size_t i = bucket * SlotsPerBucket; i < (bucket + 1) * SlotsPerBucket; ++i) {
+            if (0 == slots_[i].load(std::memory_order_relaxed)) {
+                slots_[i].store(k.fingerprint, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    // Both buckets are full: look for a path of fingerprints that can each
+    // move to their alternate bucket, ending on a free slot. The moves are
+    // then done from the end of the path, copying each fingerprint before
+    // overwriting its old slot. A reader can still miss a fingerprint that
+    // moves to a bucket it already scanned, so the moves are bracketed by
+    // moves_ and contains() scans again when it changed.
+    std::size_t path[MaxKicks];
+    std::size_t length = 0;
+    auto bucket = (walk_ & 1) ? k.bucket1 : k.bucket2;
+    for (std::size_t kick = 0; kick < MaxKicks; ++kick) {
+        walk_ ^= walk_ << 13;
+        walk_ ^= walk_ >> 7;
+        walk_ ^= walk_ << 17;
+        auto slot = bucket * SlotsPerBucket + (walk_ % SlotsPerBucket);
+        if (std::find(path, path + length, slot) != path + length) {
+            continue;
+        }
+        path[length++] = slot;
+        auto victim = slots_[slot].load(std::memory_order_relaxed);
+        bucket = altBucket(bucket, victim);
+        for (std::size_t i = bucket * SlotsPerBucket; i < (bucket + 1) * SlotsPerBucket; ++i) {
+            if (0 == slots_[i].load(std::memory_order_relaxed)) {
+                moves_.store(moves_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slots_[i].store(victim, std::memory_order_release);
+                for (auto n = length - 1; n > 0; --n) {
+                    slots_[path[n]].store(slots_[path[n - 1]].load(std::memory_order_relaxed),
+                                          std::memory_order_release);
+                }
+                slots_[path[0]].store(k.fingerprint, std::memory_order_release);
+                moves_.store(moves_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void IdDeduplicator::remove(const Key &k) {
+    for (auto bucket : {k.bucket1, k.bucket2}) {
+        for (std::size_t i = bucket * SlotsPerBucket; i < (bucket + 1) * SlotsPerBucket; ++i) {
+            if (k.fingerprint == slots_[i].load(std::memory_order_relaxed)) {
+                slots_[i].store(0, std::memory_order_release);
+                return;
+            }
+        }
+    }
+}
+
+void IdDeduplicator::evictOldest() {
+    remove(key(ring_[head_++ & ringMask_].id));
+    size_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace uprotocol::uuid
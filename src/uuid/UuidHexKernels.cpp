@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdint>
+#include <cstring>
+#include "UuidHexKernels.h"
+
+#ifdef UP_CPP_UUID_HEX_X86
+#include <immintrin.h>
+#endif
+
+namespace uprotocol::uuid::hex {
+
+/** Positions of the '-' in a canonical UUID */
+static constexpr std::size_t DashPositions[] = {8, 13, 18, 23};
+
+/** Position of the first digit of each byte in a canonical UUID */
+static constexpr std::size_t HexOffsets[] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+/**
+ * The bytes of a UUID in String order: msb then lsb, least significant first.
+ * On x86 this is also the memory layout of RawUuid, which the vector kernels rely on.
+ */
+static inline void toBytes(const RawUuid &uuid, uint8_t *bytes) {
+    for (int i = 0; i < 8; i++) {
+        bytes[i] = (uuid.msb >> (8 * i)) & 0xff;
+        bytes[i + 8] = (uuid.lsb >> (8 * i)) & 0xff;
+    }
+}
+
+static inline auto fromBytes(const uint8_t *bytes) -> RawUuid {
+    RawUuid uuid{0, 0};
+    for (int i = 7; i >= 0; i--) {
+        uuid.msb = (uuid.msb << 8) | bytes[i];
+        uuid.lsb = (uuid.lsb << 8) | bytes[i + 8];
+    }
+    return uuid;
+}
+
+static inline auto nibble(char c) -> int {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+void encodeScalar(const RawUuid *uuids, std::size_t count, char *out) {
+    static constexpr char DIGITS[] = "0123456789abcdef";
+    for (std::size_t n = 0; n < count; ++n) {
+        uint8_t bytes[16];
+        toBytes(uuids[n], bytes);
+        for (int i = 0; i < 16; i++) {
+            *out++ = DIGITS[bytes[i] >> 4];
+            *out++ = DIGITS[bytes[i] & 0xf];
+            if (i == 3 || i == 5 || i == 7 || i == 9) {
+                *out++ = '-';
+            }
+        }
+    }
+}
+
+/**
+ * Decodes one canonical string.
+ * @return false if the string is not a canonical UUID.
+ */
+static inline auto decodeOne(const char *in, RawUuid &uuid) -> bool {
+    for (auto pos : DashPositions) {
+        if ('-' != in[pos]) {
+            return false;
+        }
+    }
+    uint8_t bytes[16];
+    for (int i = 0; i < 16; i++) {
+        auto hi = nibble(in[HexOffsets[i]]);
+        auto lo = nibble(in[HexOffsets[i] + 1]);
+        if (hi < 0 || lo < 0) {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    uuid = fromBytes(bytes);
+    return true;
+}
+
+std::size_t decodeScalar(const char *in, std::size_t count, RawUuid *uuids) {
+    std::size_t valid = 0;
+    for (std::size_t n = 0; n < count; ++n, in += StringLength) {
+        if (decodeOne(in, uuids[n])) {
+            ++valid;
+        } else {
+            uuids[n] = RawUuid{0, 0};
+        }
+    }
+    return valid;
+}
+
+#ifdef UP_CPP_UUID_HEX_X86
+
+/*
+ * Layout of the 36 characters: 32 hex digits h0..h31, with '-' inserted
+ * before h8, h12, h16 and h20. They are produced (and read) as 3 blocks:
+ *   [0, 16)  h0..h7 '-' h8..h11 '-' h12 h13
+ *   [16, 32) h14 h15 '-' h16..h19 '-' h20..h27
+ *   [32, 36) h28..h31
+ */
+#define UP_CPP_Z -128
+
+__attribute__((target("sse4.1")))
+static inline auto encodeBlocks(__m128i bytes, __m128i &out0, __m128i &out1) -> __m128i {
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                         '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    auto hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+    auto lo = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, mask));
+    auto a = _mm_unpacklo_epi8(hi, lo); // h0..h15
+    auto b = _mm_unpackhi_epi8(hi, lo); // h16..h31
+    out0 = _mm_or_si128(_mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                                          UP_CPP_Z, 8, 9, 10, 11, UP_CPP_Z, 12, 13)),
+                        _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0));
+    auto c = _mm_alignr_epi8(b, a, 14); // h14..h29
+    out1 = _mm_or_si128(_mm_shuffle_epi8(c, _mm_setr_epi8(0, 1, UP_CPP_Z, 2, 3, 4, 5, UP_CPP_Z,
+                                                          6, 7, 8, 9, 10, 11, 12, 13)),
+                        _mm_setr_epi8(0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0));
+    return b;
+}
+
+__attribute__((target("sse4.1")))
+void encodeSse41(const RawUuid *uuids, std::size_t count, char *out) {
+    for (std::size_t n = 0; n < count; ++n, out += StringLength) {
+        __m128i out0;
+        __m128i out1;
+        auto b = encodeBlocks(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&uuids[n])), out0, out1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), out0);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), out1);
+        auto tail = _mm_extract_epi32(b, 3);
+        std::memcpy(out + 32, &tail, 4);
+    }
+}
+
+/**
+ * Converts 16 hex digits to 16 nibbles.
+ * @param[in,out] valid Cleared lanes for the characters that are not hex digits.
+ */
+__attribute__((target("sse4.1")))
+static inline auto nibbles(__m128i chars, __m128i &valid) -> __m128i {
+    auto digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    auto is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    auto alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    auto is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+    valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_alpha));
+    return _mm_blendv_epi8(digit, _mm_add_epi8(alpha, _mm_set1_epi8(10)), is_alpha);
+}
+
+/**
+ * Decodes the 3 blocks of a canonical string.
+ * @param[out] valid All ones if the string is a canonical UUID.
+ * @return the 16 bytes of the UUID.
+ */
+__attribute__((target("sse4.1")))
+static inline auto decodeBlocks(__m128i in0, __m128i in1, __m128i in2, bool &valid) -> __m128i {
+    auto dashes = _mm_or_si128(_mm_shuffle_epi8(in0, _mm_setr_epi8(8, 13, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                                    UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                                    UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z)),
+                               _mm_shuffle_epi8(in1, _mm_setr_epi8(UP_CPP_Z, UP_CPP_Z, 2, 7, UP_CPP_Z, UP_CPP_Z,
+                                                                    UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                                    UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z)));
+    auto a = _mm_or_si128(_mm_shuffle_epi8(in0, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15,
+                                                              UP_CPP_Z, UP_CPP_Z)),
+                          _mm_shuffle_epi8(in1, _mm_setr_epi8(UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                              UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                              UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, 0, 1)));
+    auto b = _mm_or_si128(_mm_shuffle_epi8(in1, _mm_setr_epi8(3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15,
+                                                              UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z)),
+                          _mm_shuffle_epi8(in2, _mm_setr_epi8(UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                              UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z, UP_CPP_Z,
+                                                              UP_CPP_Z, UP_CPP_Z, 0, 1, 2, 3)));
+    auto ok = _mm_set1_epi8(-1);
+    auto na = nibbles(a, ok);
+    auto nb = nibbles(b, ok);
+    ok = _mm_and_si128(ok, _mm_or_si128(_mm_cmpeq_epi8(dashes, _mm_set1_epi8('-')),
+                                        _mm_setr_epi8(0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+    valid = 0xffff == _mm_movemask_epi8(ok);
+    // (high nibble * 16) + low nibble for each pair of digits
+    const auto weights = _mm_set1_epi16(0x0110);
+    return _mm_packus_epi16(_mm_maddubs_epi16(na, weights), _mm_maddubs_epi16(nb, weights));
+}
+
+__attribute__((target("sse4.1")))
+std::size_t decodeSse41(const char *in, std::size_t count, RawUuid *uuids) {
+    std::size_t valid_count = 0;
+    for (std::size_t n = 0; n < count; ++n, in += StringLength) {
+        int32_t tail;
+        std::memcpy(&tail, in + 32, 4);
+        bool valid = false;
+        auto bytes = decodeBlocks(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)),
+                                  _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)),
+                                  _mm_cvtsi32_si128(tail), valid);
+        if (valid) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&uuids[n]), bytes);
+            ++valid_count;
+        } else {
+            uuids[n] = RawUuid{0, 0};
+        }
+    }
+    return valid_count;
+}
+
+__attribute__((target("avx2")))
+void encodeAvx2(const RawUuid *uuids, std::size_t count, char *out) {
+    const __m256i digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+                                            '0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    const __m256i index0 = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, UP_CPP_Z, 8, 9, 10, 11, UP_CPP_Z, 12, 13,
+                                            0, 1, 2, 3, 4, 5, 6, 7, UP_CPP_Z, 8, 9, 10, 11, UP_CPP_Z, 12, 13);
+    const __m256i dash0 = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0,
+                                           0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0);
+    const __m256i index1 = _mm256_setr_epi8(0, 1, UP_CPP_Z, 2, 3, 4, 5, UP_CPP_Z, 6, 7, 8, 9, 10, 11, 12, 13,
+                                            0, 1, UP_CPP_Z, 2, 3, 4, 5, UP_CPP_Z, 6, 7, 8, 9, 10, 11, 12, 13);
+    const __m256i dash1 = _mm256_setr_epi8(0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0);
+    std::size_t n = 0;
+    // two UUIDs per iteration, one in each 128 bit lane
+    for (; n + 2 <= count; n += 2, out += 2 * StringLength) {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&uuids[n]));
+        auto hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        auto lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, mask));
+        auto a = _mm256_unpacklo_epi8(hi, lo);
+        auto b = _mm256_unpackhi_epi8(hi, lo);
+        auto out0 = _mm256_or_si256(_mm256_shuffle_epi8(a, index0), dash0);
+        auto out1 = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_alignr_epi8(b, a, 14), index1), dash1);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(out0));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), _mm256_castsi256_si128(out1));
+        auto tail = _mm256_extract_epi32(b, 3);
+        std::memcpy(out + 32, &tail, 4);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + StringLength), _mm256_extracti128_si256(out0, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + StringLength + 16), _mm256_extracti128_si256(out1, 1));
+        tail = _mm256_extract_epi32(b, 7);
+        std::memcpy(out + StringLength + 32, &tail, 4);
+    }
+    encodeSse41(uuids + n, count - n, out);
+}
+
+/**
+ * Same as nibbles(), on two strings.
+ */
+__attribute__((target("avx2")))
+static inline auto nibbles2(__m256i chars, __m256i &valid) -> __m256i {
+    auto digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    auto is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    auto alpha = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    auto is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    valid = _mm256_and_si256(valid, _mm256_or_si256(is_digit, is_alpha));
+    return _mm256_blendv_epi8(digit, _mm256_add_epi8(alpha, _mm256_set1_epi8(10)), is_alpha);
+}
+
+/**
+ * Loads the same block of two consecutive strings, one in each 128 bit lane.
+ */
+__attribute__((target("avx2")))
+static inline auto loadBlock2(const char *in) -> __m256i {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in))),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + StringLength)), 1);
+}
+
+/**
+ * Same 16 bytes shuffle in both lanes.
+ */
+#define UP_CPP_LANES(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+__attribute__((target("avx2")))
+std::size_t decodeAvx2(const char *in, std::size_t count, RawUuid *uuids) {
+    const auto z = UP_CPP_Z;
+    const __m256i dash_index0 = UP_CPP_LANES(8, 13, z, z, z, z, z, z, z, z, z, z, z, z, z, z);
+    const __m256i dash_index1 = UP_CPP_LANES(z, z, 2, 7, z, z, z, z, z, z, z, z, z, z, z, z);
+    const __m256i a_index0 = UP_CPP_LANES(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, z, z);
+    const __m256i a_index1 = UP_CPP_LANES(z, z, z, z, z, z, z, z, z, z, z, z, z, z, 0, 1);
+    const __m256i b_index1 = UP_CPP_LANES(3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, z, z, z, z);
+    const __m256i b_index2 = UP_CPP_LANES(z, z, z, z, z, z, z, z, z, z, z, z, 0, 1, 2, 3);
+    const __m256i dash_mask = UP_CPP_LANES(0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+
+    std::size_t valid_count = 0;
+    std::size_t n = 0;
+    // two strings per iteration, one in each 128 bit lane
+    for (; n + 2 <= count; n += 2, in += 2 * StringLength) {
+        auto in0 = loadBlock2(in);
+        auto in1 = loadBlock2(in + 16);
+        int32_t tail0;
+        int32_t tail1;
+        std::memcpy(&tail0, in + 32, 4);
+        std::memcpy(&tail1, in + StringLength + 32, 4);
+        auto in2 = _mm256_setr_epi32(tail0, 0, 0, 0, tail1, 0, 0, 0);
+
+        auto dashes = _mm256_or_si256(_mm256_shuffle_epi8(in0, dash_index0), _mm256_shuffle_epi8(in1, dash_index1));
+        auto a = _mm256_or_si256(_mm256_shuffle_epi8(in0, a_index0), _mm256_shuffle_epi8(in1, a_index1));
+        auto b = _mm256_or_si256(_mm256_shuffle_epi8(in1, b_index1), _mm256_shuffle_epi8(in2, b_index2));
+        auto ok = _mm256_set1_epi8(-1);
+        auto na = nibbles2(a, ok);
+        auto nb = nibbles2(b, ok);
+        ok = _mm256_and_si256(ok, _mm256_or_si256(_mm256_cmpeq_epi8(dashes, _mm256_set1_epi8('-')), dash_mask));
+        auto valid = static_cast<uint32_t>(_mm256_movemask_epi8(ok));
+        auto bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(na, weights), _mm256_maddubs_epi16(nb, weights));
+
+        if (0xffff == (valid & 0xffff)) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&uuids[n]), _mm256_castsi256_si128(bytes));
+            ++valid_count;
+        } else {
+            uuids[n] = RawUuid{0, 0};
+        }
+        if (0xffff == (valid >> 16)) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&uuids[n + 1]), _mm256_extracti128_si256(bytes, 1));
+            ++valid_count;
+        } else {
+            uuids[n + 1] = RawUuid{0, 0};
+        }
+    }
+    return valid_count + decodeSse41(in, count - n, uuids + n);
+}
+
+#undef UP_CPP_LANES
+#undef UP_CPP_Z
+
+#endif // UP_CPP_UUID_HEX_X86
+
+} // namespace uprotocol::uuid::hex
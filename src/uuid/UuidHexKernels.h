@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _UUID_HEX_KERNELS_H_
+#define _UUID_HEX_KERNELS_H_
+
+#include <cstddef>
+#include <up-cpp/uuid/datamodel/RawUuid.h>
+
+/**
+ * Bulk conversion of raw UUIDs to and from their canonical 36 characters
+ * String format. Every kernel gives byte identical results; the vector ones
+ * are only available when the CPU supports their instruction set.
+ */
+namespace uprotocol::uuid::hex {
+
+/** Number of characters of a canonical UUID */
+constexpr std::size_t StringLength = 36;
+
+/**
+ * Encodes count UUIDs into count * StringLength characters.
+ */
+using EncodeKernel = void (*)(const RawUuid *uuids, std::size_t count, char *out);
+
+/**
+ * Decodes count canonical UUID strings, stored back to back.
+ * Invalid strings are decoded as {0, 0}.
+ * @return Number of valid strings.
+ */
+using DecodeKernel = std::size_t (*)(const char *in, std::size_t count, RawUuid *uuids);
+
+void encodeScalar(const RawUuid *uuids, std::size_t count, char *out);
+std::size_t decodeScalar(const char *in, std::size_t count, RawUuid *uuids);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UP_CPP_UUID_HEX_X86 1
+
+void encodeSse41(const RawUuid *uuids, std::size_t count, char *out);
+std::size_t decodeSse41(const char *in, std::size_t count, RawUuid *uuids);
+
+void encodeAvx2(const RawUuid *uuids, std::size_t count, char *out);
+std::size_t decodeAvx2(const char *in, std::size_t count, RawUuid *uuids);
+#endif
+
+} // namespace uprotocol::uuid::hex
+
+#endif // _UUID_HEX_KERNELS_H_
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <up-cpp/uuid/factory/UuidPool.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+
+namespace uprotocol::uuid {
+
+UuidPool::UuidPool(std::size_t capacity,
+                   std::chrono::microseconds refillInterval,
+                   std::chrono::milliseconds maxAge)
+    : maxAge_(static_cast<uint64_t>(std::max<std::chrono::milliseconds::rep>(maxAge.count(), 0))) {
+    std::size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mask_ = size - 1;
+    ring_ = std::make_unique<Slot[]>(size);
+    batch_ = std::make_unique<RawUuid[]>(size);
+    thread_ = std::thread(&UuidPool::refill, this, refillInterval);
+}
+
+UuidPool::~UuidPool() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex_);
+        running_.store(false, std::memory_order_relaxed);
+    }
+    stopCondition_.notify_one();
+    thread_.join();
+}
+
+RawUuid UuidPool::take() {
+    auto head = head_.load(std::memory_order_relaxed);
+    for (;;) {
+        // the background thread expired the slots before skip_
+        head = std::max(head, skip_.load(std::memory_order_acquire));
+        if (head == tail_.load(std::memory_order_acquire)) {
+            break;
+        }
+        auto &slot = ring_[head & mask_];
+        RawUuid id{slot.msb.load(std::memory_order_relaxed),
+                   slot.lsb.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (skip_.load(std::memory_order_relaxed) > head) {
+            // expired, and maybe overwritten, while it was copied
+            continue;
+        }
+        head_.store(++head, std::memory_order_release);
+        if (id.msb > lastMsb_) {
+            lastMsb_ = id.msb;
+            return id;
+        }
+        // generated before the last inline UUID
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    head_.store(head, std::memory_order_release);
+    dryCount_.fetch_add(1, std::memory_order_relaxed);
+    RawUuid id;
+    Uuidv8Factory::createBatch(1, &id);
+    lastMsb_ = id.msb;
+    return id;
+}
+
+UUID UuidPool::takeUUID() {
+    return Uuidv8Factory::toUUID(take());
+}
+
+std::size_t UuidPool::expire(std::size_t head, std::size_t tail) {
+    auto first = std::max(head, skip_.load(std::memory_order_relaxed));
+    if (first == tail) {
+        return first;
+    }
+    auto now = Uuidv8Factory::now();
+    if (now <= maxAge_) {
+        return first;
+    }
+    // the ring is increasing: the expired UUIDs are the oldest unread ones
+    auto oldest = now - maxAge_;
+    auto next = first;
+    while (next != tail &&
+           RawUuid{ring_[next & mask_].msb.load(std::memory_order_relaxed), 0}.getTime() < oldest) {
+        ++next;
+    }
+    if (next != first) {
+        expiredCount_.fetch_add(next - first, std::memory_order_relaxed);
+        skip_.store(next, std::memory_order_release);
+    }
+    return next;
+}
+
+void UuidPool::refill(std::chrono::microseconds refillInterval) {
+    while (running_.load(std::memory_order_relaxed)) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto head = expire(head_.load(std::memory_order_acquire), tail);
+        auto free = capacity() - (tail - head);
+        // fill the free slots up to the end of the ring, then wrap on the next pass
+        auto count = std::min(free, capacity() - (tail & mask_));
+        if (0 != count) {
+            Uuidv8Factory::createBatch(count, batch_.get());
+            // take() sees skip_ moved before it sees an expired slot overwritten
+            std::atomic_thread_fence(std::memory_order_release);
+            for (std::size_t i = 0; i < count; ++i) {
+                auto &slot = ring_[(tail + i) & mask_];
+                slot.msb.store(batch_[i].msb, std::memory_order_relaxed);
+                slot.lsb.store(batch_[i].lsb, std::memory_order_relaxed);
+            }
+            tail_.store(tail + count, std::memory_order_release);
+        }
+        if (count == free) {
+            std::unique_lock<std::mutex> lock(stopMutex_);
+            stopCondition_.wait_for(lock, refillInterval, [this]() {
+                return !running_.load(std::memory_order_relaxed);
+            });
+        }
+    }
+}
+
+} //uprotocol::uuid
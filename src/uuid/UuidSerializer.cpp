@@ -23,122 +23,198 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <array>
+#include <atomic>
 #include <up-cpp/uuid/serializer/UuidSerializer.h>
+#include "UuidHexKernels.h"
 
 namespace uprotocol::uuid {
 
-std::string UuidSerializer::serializeToString(UUID uuid) {
-    std::array<uint8_t, uuidSize_> buff{};
-    std::string buff_str{};
-    uint64_t msb = uuid.msb();
-    uint64_t lsb = uuid.lsb();
-    for (int i = 0; i < 8; i++) {
-        buff[i] = ((msb >> (8 * i)) & 0XFF);
-        buff[i + 8] = ((lsb >> (8 * i)) & 0XFF);
+static_assert(hex::StringLength == UuidSerializer::StringLength);
+
+/**
+ * @return true if the CPU supports the kernel
+ */
+static bool isSupported(UuidSerializer::HexKernel kernel) {
+    switch (kernel) {
+        case UuidSerializer::HexKernel::Scalar:
+            return true;
+#ifdef UP_CPP_UUID_HEX_X86
+        case UuidSerializer::HexKernel::Sse41:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1");
+        case UuidSerializer::HexKernel::Avx2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
     }
+}
 
-    static const char DIGITS[] = "0123456789abcdef";
-    std::string str{};
-    for (int i = 0; i < uuidSize_; i++) {
-        auto e = (std::byte)buff[i];
-        auto shifted_e = (std::byte)buff[i];
-        shifted_e >>= 4;
-        str += DIGITS[(std::uint8_t)(shifted_e)];
-        str += DIGITS[(std::uint8_t)(e & (std::byte)0xf)];
-        if (i == 3 || i == 5 || i == 7 || i == 9) {
-            str += '-';
+/**
+ * @return the best kernel supported by the CPU
+ */
+static UuidSerializer::HexKernel bestHexKernel() {
+    for (auto kernel : {UuidSerializer::HexKernel::Avx2, UuidSerializer::HexKernel::Sse41}) {
+        if (isSupported(kernel)) {
+            return kernel;
         }
     }
-    return str;
+    return UuidSerializer::HexKernel::Scalar;
 }
 
-std::vector<uint8_t> UuidSerializer::serializeToBytes(UUID uuid) {
-    std::vector<std::uint8_t> byteArray(uuidSize_);
-    uint64_t msb = uuid.msb();
-    uint64_t lsb = uuid.lsb();
+static std::atomic<UuidSerializer::HexKernel> hexKernel_{bestHexKernel()};
 
-    for (int i = 0; i < 8; i++) {
-        byteArray[i] = ((msb >> (8 * i)) & 0XFF);
-        byteArray[i + 8] = ((lsb >> (8 * i)) & 0XFF);
+bool UuidSerializer::setHexKernel(HexKernel kernel) {
+    if (!isSupported(kernel)) {
+        return false;
     }
-
-    return byteArray;
+    hexKernel_.store(kernel, std::memory_order_relaxed);
+    return true;
 }
 
-UUID UuidSerializer::deserializeFromString(std::string uuidStr) {
-    std::vector<uint8_t>  buffVect(uuidSize_);
+UuidSerializer::HexKernel UuidSerializer::getHexKernel() {
+    return hexKernel_.load(std::memory_order_relaxed);
+}
 
-    if (-1 == UuidSerializer::uuidFromString(uuidStr,
-                                             buffVect)) {
-        spdlog::error("UUID string contains invalid data. This can result"
-                      "in Invalid UUID number, so returning an instant UUID number.");
-        return createUUID(0,0);
+void UuidSerializer::serializeToStrings(const RawUuid *uuids,
+                                        std::size_t count,
+                                        char *out) {
+    switch (getHexKernel()) {
+#ifdef UP_CPP_UUID_HEX_X86
+        case HexKernel::Avx2:
+            return hex::encodeAvx2(uuids, count, out);
+        case HexKernel::Sse41:
+            return hex::encodeSse41(uuids, count, out);
+#endif
+        default:
+            return hex::encodeScalar(uuids, count, out);
     }
+}
 
-    uint64_t msbNum = 0;
-    uint64_t lsbNum = 0;
-    for (auto i = 7; i >= 0; i--) {
-        msbNum <<= 8;
-        lsbNum <<= 8;
-        msbNum |= (uint64_t)buffVect[i];
-        lsbNum |= (uint64_t)buffVect[i + 8];
+std::size_t UuidSerializer::deserializeFromStrings(const char *in,
+                                                   std::size_t count,
+                                                   RawUuid *uuids) {
+    switch (getHexKernel()) {
+#ifdef UP_CPP_UUID_HEX_X86
+        case HexKernel::Avx2:
+            return hex::decodeAvx2(in, count, uuids);
+        case HexKernel::Sse41:
+            return hex::decodeSse41(in, count, uuids);
+#endif
+        default:
+            return hex::decodeScalar(in, count, uuids);
     }
-    return createUUID(msbNum, lsbNum);
 }
 
-UUID UuidSerializer::deserializeFromBytes(std::vector<uint8_t> bytes) {
-    uint64_t msbNum = 0;
-    uint64_t lsbNum = 0;
-    const int size = bytes.size();
-    if( size != uuidSize_ ) {
-        spdlog::error("UUID byte array with invalid size: {}", size);
-        return createUUID(0,0);
-    }
+std::string UuidSerializer::serializeToString(UUID uuid) {
+    char buff[StringLength];
+    serializeToString(uuid, buff);
+    return std::string(buff, StringLength);
+}
 
-    for (auto i = 7; i >= 0; i--) {
-        msbNum <<= 8;
-        lsbNum <<= 8;
-        msbNum |= (uint64_t)bytes[i];
-        lsbNum |= (uint64_t)bytes[i + 8];
+void UuidSerializer::serializeToString(const UUID &uuid,
+                                       char (&out)[StringLength]) {
+    serializeToString(RawUuid{uuid.msb(), uuid.lsb()}, out);
+}
+
+void UuidSerializer::serializeToString(const RawUuid &uuid,
+                                       char (&out)[StringLength]) {
+    hex::encodeScalar(&uuid, 1, out);
+}
+
+std::vector<uint8_t> UuidSerializer::serializeToBytes(UUID uuid) {
+    std::vector<std::uint8_t> byteArray(uuidSize_);
+    toBytes(uuid.msb(), uuid.lsb(), byteArray.data());
+    return byteArray;
+}
+
+void UuidSerializer::serializeToBytes(const UUID &uuid,
+                                      std::array<uint8_t, BytesLength> &out) {
+    toBytes(uuid.msb(), uuid.lsb(), out.data());
+}
+
+UUID UuidSerializer::deserializeFromString(std::string_view uuidStr) {
+    RawUuid uuid{};
+    if (!deserializeFromString(uuidStr, uuid)) {
+        spdlog::error("UUID string contains invalid data. This can result"
+                      "in Invalid UUID number, so returning an instant UUID number.");
+        return createUUID(0,0);
     }
-    return createUUID(msbNum, lsbNum);
+    return createUUID(uuid.msb, uuid.lsb);
 }
 
-int UuidSerializer::uuidFromString(std::string str,
-                                   std::vector<uint8_t> &uuidOut) {
-    str.erase(remove(str.begin(),
-                    str.end(),
-                    '-'),
-                        str.end());
+bool UuidSerializer::deserializeFromString(std::string_view uuidStr,
+                                           RawUuid &uuid) {
+    uint8_t buff[uuidSize_] = {0};
     auto i = 0;
-    for (auto c : str) {
+    for (auto c : uuidStr) {
         uint8_t n;
 
-        if (std::isdigit(c)) {
+        if (c == '-') {
+            continue;
+        } else if (c >= '0' && c <= '9') {
             n = c - '0';
-        } else if (std::isxdigit(c)) {
-            n = std::tolower(c) - 'a' + 10;
+        } else if (c >= 'a' && c <= 'f') {
+            n = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            n = c - 'A' + 10;
         } else {
-            return -1; // Invalid character
+            return false; // Invalid character
         }
 
-        //uuidOut of size 16, index should not go beyond 15.
+        //buff of size 16, index should not go beyond 15.
         int index = i >> 1;
-        if(index > 15) {
-            return -1;
+        if (index > 15) {
+            return false;
         }
 
         if ((i & 1) == 0) {
-            uuidOut[index] =
-                (std::uint8_t)((std::byte)n << 4);  // even i => hi 4 bits
+            buff[index] = n << 4;  // even i => hi 4 bits
         } else {
-            uuidOut[index] = (std::uint8_t)(((std::byte)uuidOut[index]) |
-                                                (std::byte)n);  // odd i => lo 4 bits
+            buff[index] |= n;  // odd i => lo 4 bits
         }
         i++;
     }
-    return 0;
+    uuid = fromBytes(buff);
+    return true;
+}
+
+UUID UuidSerializer::deserializeFromBytes(std::vector<uint8_t> bytes) {
+    const int size = bytes.size();
+    if( size != uuidSize_ ) {
+        spdlog::error("UUID byte array with invalid size: {}", size);
+        return createUUID(0,0);
+    }
+
+    auto uuid = fromBytes(bytes.data());
+    return createUUID(uuid.msb, uuid.lsb);
+}
+
+UUID UuidSerializer::deserializeFromBytes(const std::array<uint8_t, BytesLength> &bytes) {
+    auto uuid = fromBytes(bytes.data());
+    return createUUID(uuid.msb, uuid.lsb);
+}
+
+void UuidSerializer::toBytes(uint64_t msb,
+                             uint64_t lsb,
+                             uint8_t *out) {
+    for (int i = 0; i < 8; i++) {
+        out[i] = ((msb >> (8 * i)) & 0XFF);
+        out[i + 8] = ((lsb >> (8 * i)) & 0XFF);
+    }
+}
+
+RawUuid UuidSerializer::fromBytes(const uint8_t *bytes) {
+    uint64_t msbNum = 0;
+    uint64_t lsbNum = 0;
+    for (auto i = 7; i >= 0; i--) {
+        msbNum <<= 8;
+        lsbNum <<= 8;
+        msbNum |= (uint64_t)bytes[i];
+        lsbNum |= (uint64_t)bytes[i + 8];
+    }
+    return RawUuid{msbNum, lsbNum};
 }
 
 UUID UuidSerializer::createUUID(uint64_t msb,
@@ -23,36 +23,229 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <time.h>
+#include <pthread.h>
 #include <up-cpp/uuid/factory/Uuidv8Factory.h>
 
 namespace uprotocol::uuid {
 
+namespace {
+
+uint64_t realtimeMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+uint64_t realtimeCoarseMs() {
+    struct timespec ts;
+#ifdef CLOCK_REALTIME_COARSE
+    clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+#else
+    clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+    return static_cast<uint64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+}
+
+/**
+ * Helper thread of Clock::Cached, storing the time at each millisecond.
+ * The thread is detached: it exits when the generation it was started in
+ * is over, so that stopping it never blocks the caller.
+ */
+class CachedClock {
+public:
+    uint64_t now() {
+        if (forked_.load(std::memory_order_relaxed)) {
+            // the helper thread did not survive fork()
+            restart();
+        }
+        return time_.load(std::memory_order_relaxed);
+    }
+
+    void start() {
+        static std::once_flag atfork;
+        std::call_once(atfork, []() {
+            pthread_atfork(nullptr, nullptr, []() {
+                instance().forked_.store(true, std::memory_order_relaxed);
+            });
+        });
+        std::lock_guard<std::mutex> lock(mutex_);
+        time_.store(realtimeMs(), std::memory_order_relaxed);
+        if (!running_) {
+            running_ = true;
+            std::thread(&CachedClock::run, this, ++generation_).detach();
+        }
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            running_ = false;
+            ++generation_;
+        }
+    }
+
+    static CachedClock &instance() {
+        // never destroyed, the helper thread may outlive static destruction
+        static auto *clock = new CachedClock;
+        return *clock;
+    }
+
+private:
+    void restart() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (forked_.exchange(false, std::memory_order_relaxed) && running_) {
+            time_.store(realtimeMs(), std::memory_order_relaxed);
+            std::thread(&CachedClock::run, this, ++generation_).detach();
+        }
+    }
+
+    void run(uint64_t generation) {
+        while (generation == generation_.load(std::memory_order_relaxed)) {
+            auto now = std::chrono::system_clock::now();
+            time_.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+                now.time_since_epoch()).count(), std::memory_order_relaxed);
+            // wake up right after the next millisecond boundary
+            std::this_thread::sleep_until(
+                std::chrono::time_point_cast<std::chrono::milliseconds>(now) + std::chrono::milliseconds(1));
+        }
+    }
+
+    std::mutex mutex_;
+    bool running_ = false;
+    std::atomic<uint64_t> generation_{0};
+    std::atomic<uint64_t> time_{0};
+    std::atomic<bool> forked_{false};
+};
+
+} // namespace
+
+void Uuidv8Factory::setClock(Clock clock) {
+    if (Clock::Cached == clock) {
+        CachedClock::instance().start();
+    }
+    clock_.store(clock, std::memory_order_relaxed);
+    if (Clock::Cached != clock) {
+        CachedClock::instance().stop();
+    }
+}
+
+uint64_t Uuidv8Factory::now() {
+    switch (getClock()) {
+        case Clock::RealtimeCoarse:
+            return realtimeCoarseMs();
+        case Clock::Cached:
+            return CachedClock::instance().now();
+        case Clock::Manual:
+            return manualTime_.load(std::memory_order_relaxed);
+        case Clock::Realtime:
+        default:
+            return realtimeMs();
+    }
+}
+
 UUID Uuidv8Factory::create() {
-    // Get the current time from the monotonic clock
-    std::chrono::time_point<std::chrono::steady_clock> currentTime = std::chrono::steady_clock::now();
-    // Convert the time point to a duration in milliseconds
-    std::chrono::milliseconds ms = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime.time_since_epoch());
-    uint64_t now = ms.count();
+    RawUuid id;
+    createBatch(1, &id);
+    return toUUID(id);
+}
 
-    msb_ = (now << 16) | version_;  // 48 bit clock 4 bits version_ custom_b
-    auto prevMsb = getLastMsb();
+void Uuidv8Factory::createBatch(std::size_t count,
+                                RawUuid *ids) {
+    if (Mode::ThreadLocal == getMode()) {
+        createThreadLocalBatch(count, ids);
+        return;
+    }
+    std::size_t done = 0;
+    while (done < count) {
+        uint64_t msb = 0;
+        auto reserved = reserve(count - done, msb);
+        for (uint64_t i = 0; i < reserved; ++i) {
+            ids[done++] = RawUuid{msb + i, lsb_};
+        }
+    }
+}
 
-    auto time = prevMsb >> 16;
-    auto count = prevMsb & 0xFFFL;
+void Uuidv8Factory::createThreadLocalBatch(std::size_t count,
+                                           RawUuid *ids) {
+    static thread_local ThreadState state;
+    if (RandomGenerator::getForkGeneration() != state.forkGeneration) {
+        // forked child: do not replay the ids of the parent thread
+        state = ThreadState();
+    }
+    std::size_t done = 0;
+    while (done < count) {
+        uint64_t msb = 0;
+        if (!nextMsb(state.lastMsb, msb)) {
+            // counter exhausted, wait for the next tick
+            std::this_thread::yield();
+            continue;
+        }
+        auto reserved = std::min<uint64_t>(count - done, maxCount_ - (msb & maxCount_) + 1);
+        for (uint64_t i = 0; i < reserved; ++i) {
+            ids[done++] = RawUuid{msb + i, state.lsb};
+        }
+        state.lastMsb = msb + reserved - 1;
+    }
+}
 
-    if ((now <= time) &&
-        (now > (time - clockDriftTolerance_))) {
-        // add to count up to MAX_COUNT (12 bits) no need to change
-        // since we maintain the variant and random
-        msb_ =  (count < maxCount_)
-                ? prevMsb + 1
-                : prevMsb;
-    }
-    lastMsb_ = msb_;
+UUID Uuidv8Factory::toUUID(const RawUuid &id) {
     UUID uuid;
-    uuid.set_msb(msb_);
-    uuid.set_lsb(lsb_);
+    uuid.set_msb(id.msb);
+    uuid.set_lsb(id.lsb);
     return uuid;
 }
 
-} //uprotocol::uuid
\ No newline at end of file
+bool Uuidv8Factory::nextMsb(uint64_t prevMsb,
+                            uint64_t &msb) {
+    auto now = Uuidv8Factory::now();
+
+    msb = (now << 16) | version_;  // 48 bit clock 4 bits version_ custom_b
+
+    auto time = prevMsb >> 16;
+    auto prevCount = prevMsb & maxCount_;
+
+    if ((now <= time) &&
+        (now + clockDriftTolerance_ > time)) {
+        // same tick (or clock behind within tolerance), keep counting
+        // up to MAX_COUNT (12 bits) from the last generated msb
+        if (prevCount < maxCount_) {
+            msb = prevMsb + 1;
+        } else if (now < time || Overflow::Borrow == getOverflow()) {
+            // counter exhausted, continue on the next tick. When the clock
+            // is behind (stepped back, or ticks borrowed before), waiting for
+            // it could take as long as the step, so the tick is borrowed.
+            msb = ((time + 1) << 16) | version_;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t Uuidv8Factory::reserve(uint64_t count,
+                                uint64_t &first) {
+    auto prevMsb = lastMsb_.load(std::memory_order_relaxed);
+    while (true) {
+        uint64_t msb = 0;
+        if (!nextMsb(prevMsb, msb)) {
+            // counter exhausted, wait for the next tick
+            std::this_thread::yield();
+            prevMsb = lastMsb_.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        auto reserved = std::min(count, maxCount_ - (msb & maxCount_) + 1);
+        if (lastMsb_.compare_exchange_weak(prevMsb,
+                                           msb + reserved - 1,
+                                           std::memory_order_relaxed)) {
+            first = msb;
+            return reserved;
+        }
+    }
+}
+
+} //uprotocol::uuid
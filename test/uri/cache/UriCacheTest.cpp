@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/cache/UriCache.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/validator/UriValidator.h>
+
+using namespace uprotocol::uri;
+
+// Test that a cached URI is the same as the deserialized one.
+TEST(UriCache, testCachedUriIsDeserializedUri) {
+    UriCache cache;
+    const std::string uri = "//vcu.my_car_vin/body.access/1/door.front_left#Door";
+    auto cached = cache.deserialize(uri);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_EQ(LongUriSerializer::serialize(*cached), uri);
+    EXPECT_EQ(LongUriSerializer::serialize(LongUriSerializer::deserialize(uri)), uri);
+    EXPECT_TRUE(cache.isValid(uri));
+}
+
+// Test hit and miss counters.
+TEST(UriCache, testHitsAndMisses) {
+    UriCache cache;
+    auto first = cache.get("/body.access/1/door");
+    auto second = cache.get("/body.access/1/door");
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(1U, cache.misses());
+    EXPECT_EQ(1U, cache.hits());
+    EXPECT_EQ(1U, cache.size());
+
+    cache.clear();
+    EXPECT_EQ(0U, cache.hits());
+    EXPECT_EQ(0U, cache.misses());
+    EXPECT_EQ(0U, cache.size());
+    // entries handed out before clear() are still usable
+    EXPECT_EQ("body.access", first->uri.entity().name());
+}
+
+// Test that invalid URIs are cached as invalid.
+TEST(UriCache, testInvalidUri) {
+    UriCache cache;
+    EXPECT_FALSE(cache.isValid("////"));
+    EXPECT_FALSE(cache.isValid(""));
+    EXPECT_FALSE(cache.isValid("////"));
+    EXPECT_EQ(1U, cache.hits());
+}
+
+// Test that URIs that make deserialize throw are cached as invalid.
+TEST(UriCache, testUriWithBadVersion) {
+    UriCache cache;
+    for (auto uri : {"/body.access/abc", "/body.access/1.x/door", "/body.access/99999999999/door"}) {
+        EXPECT_FALSE(valid_uri(uri));
+        EXPECT_FALSE(cache.isValid(uri));
+        EXPECT_FALSE(cache.isValid(uri));
+        EXPECT_TRUE(isEmpty(*cache.deserialize(uri)));
+    }
+    EXPECT_EQ(3U, cache.misses());
+    EXPECT_EQ(6U, cache.hits());
+}
+
+// Test that a URI hit since the last eviction gets a second chance.
+TEST(UriCache, testSecondChanceEviction) {
+    UriCache cache(2, 1);
+    EXPECT_EQ(2U, cache.capacity());
+    (void)cache.get("/a/1");
+    (void)cache.get("/b/1");
+    (void)cache.get("/a/1");
+    (void)cache.get("/c/1");
+    EXPECT_EQ(2U, cache.size());
+    (void)cache.get("/a/1");
+    EXPECT_EQ(2U, cache.hits());
+    (void)cache.get("/b/1");
+    EXPECT_EQ(4U, cache.misses());
+}
+
+// Test that the capacity is not exceeded when it is not a multiple of the shards.
+TEST(UriCache, testCapacityBelowShards) {
+    UriCache cache(10);
+    EXPECT_EQ(10U, cache.capacity());
+    EXPECT_EQ(10U, cache.shards());
+    for (auto i = 0; i < 100; ++i) {
+        (void)cache.get("/body.access/1/door" + std::to_string(i));
+    }
+    EXPECT_EQ(10U, cache.size());
+
+    UriCache uneven(20, 16);
+    EXPECT_EQ(20U, uneven.capacity());
+    for (auto i = 0; i < 100; ++i) {
+        (void)uneven.get("/body.access/1/door" + std::to_string(i));
+    }
+    EXPECT_LE(uneven.size(), 20U);
+
+    UriCache empty(0);
+    EXPECT_EQ(1U, empty.capacity());
+    (void)empty.get("/a/1");
+    (void)empty.get("/b/1");
+    EXPECT_EQ(1U, empty.size());
+}
+
+// Test that the clock hand clears the referenced bits it passes over.
+TEST(UriCache, testReferencedBitIsCleared) {
+    UriCache cache(2, 1);
+    (void)cache.get("/a/1");
+    (void)cache.get("/b/1");
+    (void)cache.get("/a/1");
+    (void)cache.get("/b/1");
+    // both referenced: a loses its bit, then b, then a is evicted
+    (void)cache.get("/c/1");
+    (void)cache.get("/b/1");
+    EXPECT_EQ(3U, cache.hits());
+    // b is referenced again, so d replaces c
+    (void)cache.get("/d/1");
+    (void)cache.get("/b/1");
+    (void)cache.get("/a/1");
+    EXPECT_EQ(4U, cache.hits());
+    EXPECT_EQ(5U, cache.misses());
+}
+
+// Test concurrent readers of the same URIs.
+TEST(UriCache, testConcurrentReaders) {
+    UriCache cache(64, 4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache]() {
+            for (int i = 0; i < 1000; ++i) {
+                auto uri = "/body.access/1/door" + std::to_string(i % 32);
+                EXPECT_EQ("body.access", cache.deserialize(uri)->entity().name());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(4000U, cache.hits() + cache.misses());
+    EXPECT_EQ(32U, cache.size());
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/datamodel/MicroUri.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+
+static_assert(std::is_trivially_copyable_v<MicroUri>);
+
+namespace {
+
+auto makeUri(const uprotocol::v1::UAuthority& authority) -> uprotocol::v1::UUri {
+    return BuildUUri()
+        .setAutority(authority)
+        .setEntity(BuildUEntity().setId(0x1234).setMajorVersion(3).build())
+        .setResource(BuildUResource().setID(0x0102).build())
+        .build();
+}
+
+auto makeUris() -> std::vector<uprotocol::v1::UUri> {
+    return {makeUri(BuildUAuthority().build()),
+            makeUri(BuildUAuthority().setIp("192.168.1.100").build()),
+            makeUri(BuildUAuthority().setIp("2001:db8::c0a8:164").build()),
+            makeUri(BuildUAuthority().setId("vcu.my_car_vin").build())};
+}
+
+} // namespace
+
+// Test the key packs entity id, version and resource id.
+TEST(MicroUri, testLocalKey) {
+    constexpr auto uri = MicroUri::local(0x1234, 3, 0x0102);
+    static_assert(uri.key() == 0x1234030102ULL);
+    static_assert(uri.isLocal());
+    EXPECT_EQ(MicroUri::LocalLength, uri.size());
+    EXPECT_TRUE(uri.address().empty());
+}
+
+// Test parse and serialize give back the MicroUriSerializer bytes.
+TEST(MicroUri, testParseSerializeRoundTrip) {
+    for (const auto& u_uri : makeUris()) {
+        const auto bytes = MicroUriSerializer::serialize(u_uri);
+        MicroUri uri;
+        ASSERT_TRUE(MicroUri::parse(bytes.data(), bytes.size(), uri));
+        EXPECT_EQ(0x1234, uri.entityId);
+        EXPECT_EQ(3, uri.entityVersion);
+        EXPECT_EQ(0x0102, uri.resourceId);
+        EXPECT_EQ(bytes.size(), uri.size());
+
+        std::array<uint8_t, MicroUri::MaxLength> out{};
+        const auto size = uri.serialize(out.data(), out.size());
+        EXPECT_EQ(bytes, std::vector<uint8_t>(out.begin(), out.begin() + size));
+        EXPECT_EQ(0, uri.serialize(out.data(), size - 1));
+    }
+}
+
+// Test the conversions agree with serialize and deserialize.
+TEST(MicroUri, testUUriConversions) {
+    for (const auto& u_uri : makeUris()) {
+        MicroUri uri;
+        ASSERT_TRUE(MicroUriSerializer::toMicroUri(u_uri, uri));
+        const auto bytes = MicroUriSerializer::serialize(u_uri);
+        MicroUri parsed;
+        ASSERT_TRUE(MicroUri::parse(bytes.data(), bytes.size(), parsed));
+        EXPECT_EQ(parsed, uri);
+        EXPECT_EQ(MicroUriSerializer::deserialize(bytes).SerializeAsString(),
+                  MicroUriSerializer::toUUri(uri).SerializeAsString());
+    }
+    MicroUri uri;
+    EXPECT_FALSE(MicroUriSerializer::toMicroUri(BuildUUri().build(), uri));
+    EXPECT_FALSE(MicroUriSerializer::toMicroUri(
+        makeUri(BuildUAuthority().setName("vcu.my_car_vin").build()), uri));
+}
+
+// Test equality, order and hash see the address.
+TEST(MicroUri, testCompareAndHash) {
+    const auto uris = makeUris();
+    std::vector<MicroUri> micro_uris(uris.size());
+    for (std::size_t i = 0; i < uris.size(); ++i) {
+        ASSERT_TRUE(MicroUriSerializer::toMicroUri(uris[i], micro_uris[i]));
+    }
+    std::unordered_set<MicroUri> set(micro_uris.begin(), micro_uris.end());
+    EXPECT_EQ(uris.size(), set.size());
+    for (std::size_t i = 0; i < micro_uris.size(); ++i) {
+        EXPECT_EQ(1, set.count(micro_uris[i]));
+        for (std::size_t j = 0; j < micro_uris.size(); ++j) {
+            EXPECT_EQ(i == j, micro_uris[i] == micro_uris[j]);
+            EXPECT_EQ(i != j, micro_uris[i] < micro_uris[j] || micro_uris[j] < micro_uris[i]);
+        }
+    }
+    EXPECT_EQ(micro_uris[0], MicroUri::local(0x1234, 3, 0x0102));
+    EXPECT_NE(micro_uris[0], MicroUri::local(0x1234, 4, 0x0102));
+    EXPECT_LT(MicroUri::local(0x1234, 3, 0x0102), MicroUri::local(0x1234, 4, 0x0001));
+}
+
+// Test invalid bytes are not parsed.
+TEST(MicroUri, testParseInvalid) {
+    MicroUri uri;
+    std::vector<uint8_t> local = {0x1, 0x0, 0x1, 0x2, 0x12, 0x34, 0x3, 0x0};
+    EXPECT_TRUE(MicroUri::parse(local.data(), local.size(), uri));
+    EXPECT_EQ(0x1234030102ULL, uri.key());
+    EXPECT_FALSE(MicroUri::parse(local.data(), local.size() - 1, uri));
+
+    auto bad_version = local;
+    bad_version[0] = 0x9;
+    EXPECT_FALSE(MicroUri::parse(bad_version.data(), bad_version.size(), uri));
+    auto bad_type = local;
+    bad_type[1] = 0x9;
+    EXPECT_FALSE(MicroUri::parse(bad_type.data(), bad_type.size(), uri));
+    auto ipv4 = local;
+    ipv4[1] = 0x1;
+    EXPECT_FALSE(MicroUri::parse(ipv4.data(), ipv4.size(), uri));
+    ipv4.insert(ipv4.end(), {10, 0, 0, 1});
+    EXPECT_TRUE(MicroUri::parse(ipv4.data(), ipv4.size(), uri));
+    ipv4.push_back(0);
+    EXPECT_FALSE(MicroUri::parse(ipv4.data(), ipv4.size(), uri));
+    auto id = local;
+    id[1] = 0x3;
+    id.insert(id.end(), {3, 'a', 'b'});
+    EXPECT_FALSE(MicroUri::parse(id.data(), id.size(), uri));
+    id.push_back('c');
+    EXPECT_TRUE(MicroUri::parse(id.data(), id.size(), uri));
+    EXPECT_EQ("abc", uri.address());
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/builder/BuildEntity.h>
+#include <up-cpp/uri/builder/BuildUResource.h>
+#include <up-cpp/uri/builder/BuildUUri.h>
+#include <up-cpp/uri/matcher/MicroUriDispatchTable.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+
+namespace {
+
+auto bytes(const MicroUri& uri) -> std::vector<uint8_t> {
+    std::vector<uint8_t> out(MicroUri::MaxLength);
+    out.resize(uri.serialize(out.data(), out.size()));
+    return out;
+}
+
+auto listenersOf(const MicroUriDispatchTable<int>& table, const MicroUri& uri) -> std::vector<int> {
+    std::vector<int> called;
+    const auto micro = bytes(uri);
+    table.dispatch(micro.data(), micro.size(), [&called](int listener) { called.push_back(listener); });
+    return called;
+}
+
+} // namespace
+
+// Test registration, lookup and removal by key and by micro format bytes.
+TEST(MicroUriDispatchTable, testAddFindRemove) {
+    MicroUriDispatchTable<int> table;
+    const auto door = MicroUri::local(0x1234, 1, 0x8001);
+    const auto window = MicroUri::local(0x1234, 1, 0x8002);
+    const auto door2 = MicroUri::local(0x1234, 2, 0x8001);
+    EXPECT_EQ(nullptr, table.find(door.key()));
+    EXPECT_TRUE(listenersOf(table, door).empty());
+
+    EXPECT_TRUE(table.add(door, 1));
+    EXPECT_TRUE(table.add(door, 2));
+    EXPECT_TRUE(table.add(window, 3));
+    EXPECT_EQ(2U, table.size());
+    EXPECT_EQ((std::vector<int>{1, 2}), listenersOf(table, door));
+    EXPECT_EQ(std::vector<int>{3}, listenersOf(table, window));
+    EXPECT_TRUE(listenersOf(table, door2).empty());
+
+    const auto held = table.find(door.key());
+    EXPECT_TRUE(table.remove(door, 1));
+    EXPECT_FALSE(table.remove(door, 1));
+    EXPECT_FALSE(table.remove(door2, 2));
+    EXPECT_EQ(std::vector<int>{2}, listenersOf(table, door));
+    // A list already found is not changed by the updates.
+    EXPECT_EQ((std::vector<int>{1, 2}), *held);
+
+    EXPECT_TRUE(table.remove(door.key(), 2));
+    EXPECT_TRUE(table.remove(window.key(), 3));
+    EXPECT_EQ(0U, table.size());
+    EXPECT_EQ(nullptr, table.find(window.key()));
+}
+
+// Test that the bytes of MicroUriSerializer are found, and that remote or
+// malformed URIs are not.
+TEST(MicroUriDispatchTable, testMicroFormat) {
+    MicroUriDispatchTable<int> table;
+    auto u_uri = BuildUUri()
+        .setEntity(BuildUEntity().setId(29999).setMajorVersion(254).build())
+        .setResource(BuildUResource().setID(39999).build())
+        .build();
+    table.add(MicroUri::local(29999, 254, 39999), 7);
+    const auto micro = MicroUriSerializer::serialize(u_uri);
+    ASSERT_EQ(MicroUri::LocalLength, micro.size());
+    EXPECT_EQ(1U, table.dispatch(micro.data(), micro.size(), [](int listener) { EXPECT_EQ(7, listener); }));
+    EXPECT_EQ(0U, table.dispatch(micro.data(), micro.size() - 1, [](int) { FAIL(); }));
+
+    auto remote = MicroUri::local(29999, 254, 39999);
+    remote.addressType = MicroUri::AddressType::IpV4;
+    remote.addressLength = 4;
+    EXPECT_FALSE(table.add(remote, 8));
+    EXPECT_FALSE(table.remove(remote, 7));
+    EXPECT_TRUE(listenersOf(table, remote).empty());
+}
+
+// Test growth and removal with many keys, some of which collide in the table.
+TEST(MicroUriDispatchTable, testManyKeys) {
+    MicroUriDispatchTable<uint64_t> table;
+    std::vector<uint64_t> keys;
+    for (uint16_t entity = 1; entity <= 40; ++entity) {
+        for (uint16_t resource = 1; resource <= 50; ++resource) {
+            keys.push_back(MicroUri::makeKey(entity, 1, resource));
+        }
+    }
+    for (auto key : keys) {
+        table.add(key, key);
+    }
+    EXPECT_EQ(keys.size(), table.size());
+    for (std::size_t i = 0; i < keys.size(); i += 2) {
+        EXPECT_TRUE(table.remove(keys[i], keys[i]));
+    }
+    EXPECT_EQ(keys.size() / 2, table.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto listeners = table.find(keys[i]);
+        if (i % 2 == 0) {
+            EXPECT_EQ(nullptr, listeners);
+        } else {
+            ASSERT_NE(nullptr, listeners);
+            EXPECT_EQ(std::vector<uint64_t>{keys[i]}, *listeners);
+        }
+    }
+}
+
+// Test that keys outside of the 40 bit range of MicroUri::key() are rejected.
+TEST(MicroUriDispatchTable, testKeyOutOfRange) {
+    MicroUriDispatchTable<int> table;
+    constexpr auto max_key = MicroUriDispatchTable<int>::MaxKey;
+    EXPECT_EQ(MicroUri::makeKey(0xFFFF, 0xFF, 0xFFFF), max_key);
+    EXPECT_FALSE(table.add(~uint64_t{0}, 1));
+    EXPECT_FALSE(table.add(max_key + 1, 2));
+    EXPECT_EQ(0U, table.size());
+    EXPECT_EQ(nullptr, table.find(~uint64_t{0}));
+    EXPECT_FALSE(table.remove(~uint64_t{0}, 1));
+
+    EXPECT_TRUE(table.add(max_key, 3));
+    EXPECT_EQ(1U, table.size());
+    ASSERT_NE(nullptr, table.find(max_key));
+    EXPECT_EQ(std::vector<int>{3}, *table.find(max_key));
+    EXPECT_TRUE(table.remove(max_key, 3));
+    EXPECT_EQ(0U, table.size());
+}
+
+// Test that lookups see either the old or the new table while it is updated,
+// and that a listener can update the table it is called from.
+TEST(MicroUriDispatchTable, testConcurrentReaders) {
+    MicroUriDispatchTable<int> table;
+    const auto door = MicroUri::local(0x1234, 1, 0x8001);
+    table.add(door, 0);
+    const auto micro = bytes(door);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&table, &micro, &done]() {
+            while (!done.load()) {
+                int first = -1;
+                table.dispatch(micro.data(), micro.size(), [&first](int listener) {
+                    if (first < 0) {
+                        first = listener;
+                    }
+                });
+                EXPECT_EQ(0, first);
+            }
+        });
+    }
+    for (int i = 1; i < 2000; ++i) {
+        const auto other = MicroUri::local(0x1234, 1, static_cast<uint16_t>(i % 50));
+        table.add(other, i);
+        if (i % 3 == 0) {
+            EXPECT_TRUE(table.remove(other, i));
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(51U, table.size());
+
+    table.dispatch(micro.data(), micro.size(), [&table, &door](int listener) { table.remove(door, listener); });
+    EXPECT_EQ(nullptr, table.find(door.key()));
+}
+
+// Test that an update does not wait for a lookup in progress, and that the
+// listeners it replaced are freed by a later update once the lookup is over.
+TEST(MicroUriDispatchTable, testDeferredReclamation) {
+    using Listener = std::shared_ptr<int>;
+    MicroUriDispatchTable<Listener> table;
+    const auto door = MicroUri::local(0x1234, 1, 0x8001);
+    const auto window = MicroUri::local(0x1234, 1, 0x8002);
+    auto listener = std::make_shared<int>(1);
+    const std::weak_ptr<int> watch = listener;
+    table.add(door, listener);
+    const auto micro = bytes(door);
+
+    std::promise<void> entered;
+    std::promise<void> release;
+    auto lookup = std::async(std::launch::async, [&]() {
+        return table.dispatch(micro.data(), micro.size(), [&](const Listener& called) {
+            entered.set_value();
+            release.get_future().wait();
+            EXPECT_EQ(1, *called);
+        });
+    });
+    entered.get_future().wait();
+    EXPECT_TRUE(table.remove(door, listener));
+    listener.reset();
+    table.add(window, std::make_shared<int>(2));
+    EXPECT_FALSE(watch.expired());
+
+    release.set_value();
+    EXPECT_EQ(1U, lookup.get());
+    table.add(window, std::make_shared<int>(3));
+    EXPECT_TRUE(watch.expired());
+    EXPECT_EQ(nullptr, table.find(door.key()));
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
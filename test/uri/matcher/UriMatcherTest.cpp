@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/matcher/UriMatcher.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+
+using namespace uprotocol::uri;
+
+namespace {
+
+auto uri(const std::string& long_uri) -> uprotocol::v1::UUri {
+    return LongUriSerializer::deserialize(long_uri);
+}
+
+auto sorted(std::vector<int> values) -> std::vector<int> {
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+} // namespace
+
+// Test exact, entity, authority and wildcard patterns.
+TEST(UriMatcher, testPatterns) {
+    UriMatcher<int> matcher;
+    matcher.add(uri("/body.access/1/door.front_left#Door"), 1);
+    matcher.add(uri("/body.access"), 2);
+    matcher.add(uri("/body.access/2"), 3);
+    matcher.add(uri("//vcu.my_car_vin"), 4);
+    matcher.add(uri("//*/body.access/1/door"), 5);
+    matcher.add(uri("/*/1/window"), 6);
+    EXPECT_EQ(6U, matcher.size());
+
+    EXPECT_EQ(sorted({1, 2, 5}), sorted(matcher.match(uri("/body.access/1/door.front_left#Door"))));
+    EXPECT_EQ(sorted({2, 5}), sorted(matcher.match(uri("/body.access/1/door.rear_left#Door"))));
+    EXPECT_EQ(sorted({2, 3}), sorted(matcher.match(uri("/body.access/2/door"))));
+    EXPECT_EQ(sorted({2, 6}), sorted(matcher.match(uri("/body.access/1/window"))));
+    EXPECT_EQ(sorted({4, 5}), sorted(matcher.match(uri("//vcu.my_car_vin/body.access/1/door"))));
+    EXPECT_EQ(std::vector<int>{5}, matcher.match(uri("//other.vin/body.access/1/door")));
+    EXPECT_EQ(std::vector<int>{6}, matcher.match(uri("/hvac/1/window")));
+    EXPECT_TRUE(matcher.match(uri("/hvac/1/door")).empty());
+}
+
+// Test a pattern matching every URI and a subscriber registered twice.
+TEST(UriMatcher, testMatchAll) {
+    UriMatcher<int> matcher;
+    matcher.add(uri("//*"), 1);
+    matcher.add(uri("/body.access"), 2);
+    matcher.add(uri("/body.access"), 2);
+    EXPECT_EQ(sorted({1, 2, 2}), sorted(matcher.match(uri("/body.access/1/door"))));
+    EXPECT_EQ(std::vector<int>{1}, matcher.match(uri("//vcu.my_car_vin/hvac/1/fan")));
+}
+
+// Test removing subscribers.
+TEST(UriMatcher, testRemove) {
+    UriMatcher<int> matcher;
+    matcher.add(uri("/body.access/1/door"), 1);
+    matcher.add(uri("/body.access/1/door"), 2);
+    matcher.add(uri("/body.access"), 3);
+
+    EXPECT_FALSE(matcher.remove(uri("/body.access/1/door"), 3));
+    EXPECT_FALSE(matcher.remove(uri("/hvac"), 3));
+    EXPECT_TRUE(matcher.remove(uri("/body.access/1/door"), 1));
+    EXPECT_EQ(sorted({2, 3}), sorted(matcher.match(uri("/body.access/1/door"))));
+    EXPECT_TRUE(matcher.remove(uri("/body.access/1/door"), 2));
+    EXPECT_TRUE(matcher.remove(uri("/body.access"), 3));
+    EXPECT_FALSE(matcher.remove(uri("/body.access"), 3));
+    EXPECT_EQ(0U, matcher.size());
+    EXPECT_TRUE(matcher.match(uri("/body.access/1/door")).empty());
+
+    matcher.add(uri("/body.access"), 4);
+    EXPECT_EQ(std::vector<int>{4}, matcher.match(uri("/body.access/1/door")));
+}
+
+// Test that readers see either the old or the new trie while it is updated.
+TEST(UriMatcher, testConcurrentReaders) {
+    UriMatcher<int> matcher;
+    matcher.add(uri("/body.access"), 0);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&matcher, &done]() {
+            while (!done.load()) {
+                auto matches = matcher.match(uri("/body.access/1/door"));
+                EXPECT_FALSE(matches.empty());
+                EXPECT_EQ(0, matches.front());
+            }
+        });
+    }
+    for (int i = 1; i < 2000; ++i) {
+        matcher.add(uri("/body.access/1/door" + std::to_string(i % 50)), i);
+        if (i % 3 == 0) {
+            EXPECT_TRUE(matcher.remove(uri("/body.access/1/door" + std::to_string(i % 50)), i));
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(1U + 1999U - 666U, matcher.size());
+}
+
+// Test that an update does not wait for a match in progress, which keeps the
+// version it started with, and that a subscriber can update the matcher.
+TEST(UriMatcher, testUpdateDuringMatch) {
+    using Subscriber = std::shared_ptr<int>;
+    UriMatcher<Subscriber> matcher;
+    auto subscriber = std::make_shared<int>(1);
+    const std::weak_ptr<int> watch = subscriber;
+    matcher.add(uri("/body.access"), subscriber);
+
+    std::promise<void> entered;
+    std::promise<void> release;
+    auto match = std::async(std::launch::async, [&]() {
+        matcher.forEachMatch(uri("/body.access/1/door"), [&](const Subscriber& called) {
+            entered.set_value();
+            release.get_future().wait();
+            EXPECT_EQ(1, *called);
+        });
+    });
+    entered.get_future().wait();
+    EXPECT_TRUE(matcher.remove(uri("/body.access"), subscriber));
+    subscriber.reset();
+    matcher.add(uri("/body.access/1/window"), std::make_shared<int>(2));
+    EXPECT_FALSE(watch.expired());
+
+    release.set_value();
+    match.get();
+    matcher.add(uri("/body.access/1/window"), std::make_shared<int>(3));
+    EXPECT_TRUE(watch.expired());
+
+    matcher.forEachMatch(uri("/body.access/1/window"), [&matcher](const Subscriber& called) {
+        matcher.remove(uri("/body.access/1/window"), called);
+    });
+    EXPECT_EQ(0U, matcher.size());
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/builder/BuildUUri.h>
+#include <up-cpp/uri/registry/UriRegistry.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+
+// Test that the same URI is interned once.
+TEST(UriRegistry, testSameUriSameHandle) {
+    UriRegistry registry;
+    const std::string uri = "//vcu.my_car_vin/body.access/1/door.front_left#Door";
+    auto first = registry.intern(LongUriSerializer::deserialize(uri));
+    auto second = registry.intern(LongUriSerializer::deserialize(uri));
+    ASSERT_TRUE(first.isValid());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1U, registry.size());
+    EXPECT_EQ(uri, registry.longUri(first));
+    EXPECT_EQ(uri, LongUriSerializer::serialize(registry.uri(first)));
+    EXPECT_EQ(first, registry.find(LongUriSerializer::deserialize(uri)));
+}
+
+// Test that URIs differing by any field get different handles.
+TEST(UriRegistry, testDifferentUrisDifferentHandles) {
+    UriRegistry registry;
+    auto named = BuildUUri().setAutority(BuildUAuthority().build()).
+            setEntity(BuildUEntity().setName("body.access").setMajorVersion(1).build()).
+            setResource(BuildUResource().setName("door").build()).build();
+    auto with_id = BuildUUri().setAutority(BuildUAuthority().build()).
+            setEntity(BuildUEntity().setName("body.access").setId(2).setMajorVersion(1).build()).
+            setResource(BuildUResource().setName("door").build()).build();
+    auto other = LongUriSerializer::deserialize("/body.access/1/window");
+
+    auto named_handle = registry.intern(named);
+    auto with_id_handle = registry.intern(with_id);
+    auto other_handle = registry.intern(other);
+    EXPECT_NE(named_handle, with_id_handle);
+    EXPECT_NE(named_handle, other_handle);
+    EXPECT_EQ(registry.longUri(named_handle), registry.longUri(with_id_handle));
+    EXPECT_EQ(3U, registry.size());
+}
+
+// Test interning long format strings, including aliases and invalid URIs.
+TEST(UriRegistry, testInternLongUri) {
+    UriRegistry registry;
+    auto handle = registry.intern(std::string_view("//vcu.my_car_vin/body.access/1/door"));
+    ASSERT_TRUE(handle.isValid());
+    EXPECT_EQ(handle, registry.intern(std::string_view("//vcu.my_car_vin/body.access/1/door")));
+    EXPECT_EQ(handle, registry.intern(std::string_view("\\\\vcu.my_car_vin\\body.access\\1\\door")));
+    EXPECT_EQ(handle, registry.intern(LongUriSerializer::deserialize("//vcu.my_car_vin/body.access/1/door")));
+    EXPECT_EQ("//vcu.my_car_vin/body.access/1/door", registry.longUri(handle));
+    EXPECT_EQ(1U, registry.size());
+
+    EXPECT_FALSE(registry.intern(std::string_view("")).isValid());
+    EXPECT_FALSE(registry.intern(std::string_view("////body.access")).isValid());
+    EXPECT_FALSE(registry.intern(BuildUUri().build()).isValid());
+    EXPECT_EQ(1U, registry.size());
+}
+
+// Test that URIs that make deserialize throw get the invalid handle.
+TEST(UriRegistry, testInternUriWithBadVersion) {
+    UriRegistry registry;
+    EXPECT_FALSE(registry.intern(std::string_view("/body.access/abc")).isValid());
+    EXPECT_FALSE(registry.intern(std::string_view("/body.access/1.x/door")).isValid());
+    EXPECT_FALSE(registry.intern(std::string_view("/body.access/99999999999/door")).isValid());
+    EXPECT_EQ(0U, registry.size());
+}
+
+// Test the micro format of interned URIs.
+TEST(UriRegistry, testMicroUri) {
+    UriRegistry registry;
+    auto micro = BuildUUri().setAutority(BuildUAuthority().build()).
+            setEntity(BuildUEntity().setId(2).setMajorVersion(1).build()).
+            setResource(BuildUResource().setID(3).build()).build();
+    auto handle = registry.intern(micro);
+    EXPECT_EQ(MicroUriSerializer::serialize(micro), registry.microUri(handle));
+    EXPECT_FALSE(registry.microUri(handle).empty());
+
+    auto long_only = registry.intern(std::string_view("/body.access/1/door"));
+    EXPECT_TRUE(registry.microUri(long_only).empty());
+}
+
+// Test resolving handles that are not in the registry.
+TEST(UriRegistry, testUnknownHandle) {
+    UriRegistry registry;
+    EXPECT_EQ(nullptr, registry.lookup(UriHandle()));
+    EXPECT_EQ(nullptr, registry.lookup(UriHandle(1)));
+    EXPECT_TRUE(isEmpty(registry.uri(UriHandle(1))));
+    EXPECT_TRUE(registry.longUri(UriHandle(1)).empty());
+    EXPECT_TRUE(registry.microUri(UriHandle(1)).empty());
+    EXPECT_FALSE(registry.find(LongUriSerializer::deserialize("/body.access/1/door")).isValid());
+}
+
+// Test handles as keys of a hash map, and the global registry.
+TEST(UriRegistry, testHandleAsMapKey) {
+    auto &registry = UriRegistry::global();
+    EXPECT_EQ(&registry, &UriRegistry::global());
+
+    std::unordered_map<UriHandle, int> counts;
+    for (int i = 0; i < 3; ++i) {
+        ++counts[registry.intern(std::string_view("/body.access/1/door"))];
+        ++counts[registry.intern(std::string_view("/body.access/1/window"))];
+    }
+    ASSERT_EQ(2U, counts.size());
+    for (const auto &[handle, count] : counts) {
+        EXPECT_EQ(3, count);
+    }
+}
+
+// Test that concurrent interning hands out one handle per URI, across segments.
+TEST(UriRegistry, testConcurrentIntern) {
+    UriRegistry registry;
+    constexpr int Threads = 4;
+    constexpr int Uris = 3000;
+    std::vector<std::vector<UriHandle>> handles(Threads, std::vector<UriHandle>(Uris));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; ++t) {
+        threads.emplace_back([&registry, &handles, t]() {
+            for (int i = 0; i < Uris; ++i) {
+                auto uri = "/body.access/1/door" + std::to_string(i);
+                handles[t][i] = registry.intern(std::string_view(uri));
+                EXPECT_EQ(uri, registry.longUri(handles[t][i]));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(static_cast<std::size_t>(Uris), registry.size());
+    for (int t = 1; t < Threads; ++t) {
+        EXPECT_EQ(handles[0], handles[t]);
+    }
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/builder/BuildEntity.h>
+#include <up-cpp/uri/builder/BuildUAuthority.h>
+#include <up-cpp/uri/builder/BuildUResource.h>
+#include <up-cpp/uri/builder/BuildUUri.h>
+#include <up-cpp/uri/resolver/UriCatalogue.h>
+#include <up-cpp/uri/tools/Utils.h>
+
+using namespace uprotocol::uri;
+
+namespace {
+
+const std::string CataloguePath = "uri_catalogue_test.bin";
+
+auto writeCatalogue() -> bool {
+    return UriCatalogue::write(CataloguePath,
+                               {{"body.access", 0x1234}, {"hvac", 7}, {"duplicate", 7}},
+                               {{0x1234, "door.front_left#Door", 0x0102},
+                                {0x1234, "door.front_right", 3},
+                                {0x1234, "rpc.UpdateDoor", 4},
+                                {7, "fan", 1},
+                                {99, "unknown.entity", 1}},
+                               {{"VCU.my_car_vin", std::string("vcu\0id", 6)}});
+}
+
+} // namespace
+
+// Test names and ids are looked up both ways.
+TEST(UriCatalogue, testResolveAndReverse) {
+    ASSERT_TRUE(writeCatalogue());
+    const auto catalogue = UriCatalogue::open(CataloguePath);
+    ASSERT_NE(nullptr, catalogue);
+
+    EXPECT_EQ(2, catalogue->entityCount());
+    EXPECT_EQ(4, catalogue->resourceCount());
+    EXPECT_EQ(0x1234, catalogue->resolve("body.access"));
+    EXPECT_EQ(7, catalogue->resolve("hvac"));
+    EXPECT_EQ(std::nullopt, catalogue->resolve("duplicate"));
+    EXPECT_EQ(std::nullopt, catalogue->resolve("body"));
+    EXPECT_EQ("body.access", catalogue->reverse(0x1234));
+    EXPECT_EQ("", catalogue->reverse(99));
+
+    EXPECT_EQ(0x0102, catalogue->resolve(0x1234, "door.front_left"));
+    EXPECT_EQ(0x0102, catalogue->resolve(0x1234, "door.front_left#Other"));
+    EXPECT_EQ(1, catalogue->resolve(7, "fan"));
+    EXPECT_EQ(std::nullopt, catalogue->resolve(7, "door.front_left"));
+    EXPECT_EQ(std::nullopt, catalogue->resolve(99, "unknown.entity"));
+    EXPECT_EQ("door.front_left#Door", catalogue->reverse(0x1234, 0x0102));
+    EXPECT_EQ("", catalogue->reverse(7, 0x0102));
+
+    EXPECT_EQ(std::string("vcu\0id", 6), catalogue->resolveAuthority("vcu.my_car_vin"));
+    EXPECT_EQ("vcu.my_car_vin", catalogue->reverseAuthority(std::string("vcu\0id", 6)));
+    EXPECT_EQ("", catalogue->resolveAuthority("VCU.my_car_vin"));
+    std::remove(CataloguePath.c_str());
+}
+
+// Test resolved UUris are isResolved(), from names and from ids.
+TEST(UriCatalogue, testResolveUUri) {
+    ASSERT_TRUE(writeCatalogue());
+    const auto catalogue = UriCatalogue::open(CataloguePath);
+    ASSERT_NE(nullptr, catalogue);
+
+    auto by_name = BuildUUri()
+                       .setAutority(BuildUAuthority().setName("VCU.my_car_vin").build())
+                       .setEntity(BuildUEntity().setName("body.access").setMajorVersion(1).build())
+                       .setResource(BuildUResource().setName("door").setInstance("front_left").build())
+                       .build();
+    EXPECT_FALSE(isResolved(by_name));
+    const auto from_name = catalogue->resolve(by_name);
+    EXPECT_TRUE(isResolved(from_name));
+    EXPECT_EQ(0x1234, from_name.entity().id());
+    EXPECT_EQ(1, from_name.entity().version_major());
+    EXPECT_EQ(0x0102, from_name.resource().id());
+
+    auto by_id = BuildUUri()
+                     .setAutority(BuildUAuthority().setId(std::string("vcu")).build())
+                     .setEntity(BuildUEntity().setId(0x1234).build())
+                     .setResource(BuildUResource().setRpcRequest(4).build())
+                     .build();
+    by_id.mutable_authority()->set_id(std::string("vcu\0id", 6));
+    by_id.mutable_resource()->clear_name();
+    const auto from_id = catalogue->resolve(by_id);
+    EXPECT_TRUE(isResolved(from_id));
+    EXPECT_EQ("vcu.my_car_vin", from_id.authority().name());
+    EXPECT_EQ("body.access", from_id.entity().name());
+    EXPECT_EQ("rpc", from_id.resource().name());
+    EXPECT_EQ("UpdateDoor", from_id.resource().instance());
+
+    auto message = catalogue->resolve(BuildUResource().setID(0x0102).build(), 0x1234);
+    EXPECT_EQ("door", message.name());
+    EXPECT_EQ("front_left", message.instance());
+    EXPECT_EQ("Door", message.message());
+
+    auto unknown = BuildUEntity().setName("unknown").build();
+    EXPECT_EQ(unknown.SerializeAsString(), catalogue->resolve(unknown).SerializeAsString());
+    std::remove(CataloguePath.c_str());
+}
+
+// Test files that are not catalogues are rejected.
+TEST(UriCatalogue, testOpenInvalid) {
+    EXPECT_EQ(nullptr, UriCatalogue::open("no_such_catalogue.bin"));
+
+    ASSERT_TRUE(writeCatalogue());
+    std::string bytes;
+    {
+        std::ifstream in(CataloguePath, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    {
+        std::ofstream out(CataloguePath, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 1));
+    }
+    EXPECT_EQ(nullptr, UriCatalogue::open(CataloguePath));
+
+    bytes[0] = 'X';
+    {
+        std::ofstream out(CataloguePath, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    EXPECT_EQ(nullptr, UriCatalogue::open(CataloguePath));
+    std::remove(CataloguePath.c_str());
+}
+
+// Test an empty catalogue answers nothing.
+TEST(UriCatalogue, testEmptyCatalogue) {
+    ASSERT_TRUE(UriCatalogue::write(CataloguePath, {}, {}));
+    const auto catalogue = UriCatalogue::open(CataloguePath);
+    ASSERT_NE(nullptr, catalogue);
+    EXPECT_EQ(0, catalogue->entityCount());
+    EXPECT_EQ(std::nullopt, catalogue->resolve("hvac"));
+    EXPECT_EQ("", catalogue->reverse(7, 1));
+    EXPECT_EQ("", catalogue->reverseAuthority("id"));
+    std::remove(CataloguePath.c_str());
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/builder/BuildUUri.h>
+#include <up-cpp/uri/resolver/UriResolver.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/serializer/MicroUriSerializer.h>
+
+using namespace uprotocol::uri;
+
+namespace {
+
+auto makeResolver() -> UriResolver {
+    return UriResolver({{"body.access", 0x1234}, {"hvac", 7}},
+                       {{0x1234, "door.front_left#Door", 0x0102},
+                        {0x1234, "door.front_right", 3},
+                        {7, "fan", 1},
+                        {99, "unknown.entity", 1}},
+                       {{"VCU.my_car_vin", "10.0.0.1"},
+                        {"cloud.backend", "2001:db8::1"},
+                        {"gateway", "gw-id"}});
+}
+
+/**
+ * The reference path: deserialize, fill in the ids, serialize.
+ */
+auto referenceMicro(const std::string& long_uri, uint16_t entity_id, uint16_t resource_id,
+                    const std::string& ip = "", const std::string& id = "") -> std::vector<uint8_t> {
+    auto u_uri = LongUriSerializer::deserialize(long_uri);
+    auto authority = BuildUAuthority();
+    if (!ip.empty()) {
+        authority.setIp(ip);
+    } else if (!id.empty()) {
+        authority.setId(id);
+    }
+    u_uri.mutable_authority()->CopyFrom(authority.build());
+    u_uri.mutable_entity()->set_id(entity_id);
+    u_uri.mutable_resource()->set_id(resource_id);
+    return MicroUriSerializer::serialize(u_uri);
+}
+
+} // namespace
+
+// Test that transcoding gives the same bytes as the serializers.
+TEST(UriResolver, testToMicroMatchesSerializers) {
+    const auto resolver = makeResolver();
+    EXPECT_EQ(referenceMicro("/body.access/1/door.front_left#Door", 0x1234, 0x0102),
+              resolver.toMicro("/body.access/1/door.front_left#Door"));
+    EXPECT_EQ(referenceMicro("/body.access/1/door.front_left", 0x1234, 0x0102),
+              resolver.toMicro("/body.access/1/door.front_left"));
+    EXPECT_EQ(referenceMicro("/hvac/3.1/fan", 7, 1), resolver.toMicro("/hvac/3.1/fan"));
+    EXPECT_EQ(referenceMicro("/hvac//fan", 7, 1), resolver.toMicro("/hvac//fan"));
+    EXPECT_EQ(referenceMicro("//vcu.my_car_vin/hvac/1/fan", 7, 1, "10.0.0.1"),
+              resolver.toMicro("//VCU.MY_CAR_VIN/hvac/1/fan"));
+    EXPECT_EQ(referenceMicro("//cloud.backend/hvac/2/fan", 7, 1, "2001:db8::1"),
+              resolver.toMicro("//cloud.backend/hvac/2/fan"));
+    EXPECT_EQ(referenceMicro("//gateway/body.access/1/door.front_right", 0x1234, 3, "", "gw-id"),
+              resolver.toMicro("//gateway/body.access/1/door.front_right"));
+}
+
+// Test that unknown names and invalid URIs are not transcoded.
+TEST(UriResolver, testToMicroFailures) {
+    const auto resolver = makeResolver();
+    std::vector<uint8_t> micro{1, 2, 3};
+    EXPECT_FALSE(resolver.toMicro("", micro));
+    EXPECT_TRUE(micro.empty());
+    EXPECT_FALSE(resolver.toMicro("/", micro));
+    EXPECT_FALSE(resolver.toMicro("/seat/1/fan", micro));
+    EXPECT_FALSE(resolver.toMicro("/hvac/1/door", micro));
+    EXPECT_FALSE(resolver.toMicro("/hvac/1", micro));
+    EXPECT_FALSE(resolver.toMicro("/hvac/x/fan", micro));
+    EXPECT_FALSE(resolver.toMicro("/hvac/256/fan", micro));
+    EXPECT_FALSE(resolver.toMicro("//other.vin/hvac/1/fan", micro));
+    EXPECT_FALSE(resolver.toMicro("//vcu.my_car_vin", micro));
+    EXPECT_FALSE(resolver.toMicro("////hvac/1/fan", micro));
+    EXPECT_EQ(nullptr, resolver.resourceId(99, "unknown.entity"));
+}
+
+// Test transcoding micro URIs back to long URIs.
+TEST(UriResolver, testToLong) {
+    const auto resolver = makeResolver();
+    EXPECT_EQ("/body.access/1/door.front_left#Door", resolver.toLong(resolver.toMicro("/body.access/1/door.front_left")));
+    EXPECT_EQ("/hvac/0/fan", resolver.toLong(resolver.toMicro("/hvac//fan")));
+    EXPECT_EQ("//vcu.my_car_vin/hvac/1/fan", resolver.toLong(resolver.toMicro("//vcu.my_car_vin/hvac/1/fan")));
+    EXPECT_EQ("//cloud.backend/hvac/255/fan", resolver.toLong(resolver.toMicro("//cloud.backend/hvac/255/fan")));
+    EXPECT_EQ("//gateway/body.access/1/door.front_right",
+              resolver.toLong(resolver.toMicro("//gateway/body.access/1/door.front_right")));
+
+    // same as deserializing the micro URI, filling in the names and serializing it
+    auto micro = resolver.toMicro("//vcu.my_car_vin/body.access/2/door.front_right");
+    auto u_uri = MicroUriSerializer::deserialize(micro);
+    u_uri.mutable_authority()->set_name("vcu.my_car_vin");
+    u_uri.mutable_entity()->set_name("body.access");
+    u_uri.mutable_resource()->set_name("door");
+    u_uri.mutable_resource()->set_instance("front_right");
+    EXPECT_EQ(LongUriSerializer::serialize(u_uri), resolver.toLong(micro));
+
+    std::string long_uri = "previous";
+    EXPECT_FALSE(resolver.toLong(nullptr, 0, long_uri));
+    EXPECT_TRUE(long_uri.empty());
+    std::vector<uint8_t> unknown_entity{1, 4, 0, 1, 0, 8, 1, 0};
+    EXPECT_FALSE(resolver.toLong(unknown_entity.data(), unknown_entity.size(), long_uri));
+    std::vector<uint8_t> unknown_resource{1, 4, 0, 9, 0, 7, 1, 0};
+    EXPECT_FALSE(resolver.toLong(unknown_resource.data(), unknown_resource.size(), long_uri));
+    std::vector<uint8_t> unknown_ip{1, 1, 0, 1, 0, 7, 1, 0, 10, 0, 0, 2};
+    EXPECT_FALSE(resolver.toLong(unknown_ip.data(), unknown_ip.size(), long_uri));
+    std::vector<uint8_t> truncated{1, 2, 0, 1, 0, 7, 1, 0, 10, 0, 0, 2};
+    EXPECT_FALSE(resolver.toLong(truncated.data(), truncated.size(), long_uri));
+    std::vector<uint8_t> empty_id{1, 3, 0, 1, 0, 7, 1, 0, 0};
+    EXPECT_FALSE(resolver.toLong(empty_id.data(), empty_id.size(), long_uri));
+    EXPECT_TRUE(long_uri.empty());
+    std::vector<uint8_t> bad_version{2, 4, 0, 1, 0, 7, 1, 0};
+    EXPECT_FALSE(resolver.toLong(bad_version.data(), bad_version.size(), long_uri));
+}
+
+// Test the perfect hash with many keys.
+TEST(UriResolver, testPerfectHashMap) {
+    std::vector<std::pair<std::string, uint32_t>> entries;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        entries.emplace_back("service" + std::to_string(i), i);
+    }
+    entries.emplace_back("service7", 1234);
+    PerfectHashMap<std::string, uint32_t> map(entries);
+    EXPECT_EQ(5000U, map.size());
+    for (uint32_t i = 0; i < 5000; ++i) {
+        const auto* value = map.find("service" + std::to_string(i));
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(i, *value);
+    }
+    EXPECT_EQ(nullptr, map.find("service5000"));
+    EXPECT_EQ(nullptr, map.find(""));
+    const PerfectHashMap<uint32_t, uint32_t> empty;
+    EXPECT_EQ(nullptr, empty.find(1));
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
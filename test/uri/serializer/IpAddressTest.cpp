@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/builder/BuildUAuthority.h>
+#include <up-cpp/uri/serializer/IpAddress.h>
+
+using namespace uprotocol::uri;
+using AddressType = IpAddress::AddressType;
+
+namespace {
+
+const std::vector<std::string> Addresses = {
+    "192.168.1.100", "0.0.0.0", "255.255.255.255", "10.0.0.1", "1.2.3.04", "01.2.3.4", "256.1.1.1",
+    "1.2.3", "1.2.3.4.5", "1..2.3", "1.2.3.", ".1.2.3", "1.2.3.4 ", " 1.2.3.4", "1.2.3.-4", "1.2.3.4a",
+    "1234.1.1.1", "0.0.0.00", "2001:db8::1", "2001:DB8:0:0:0:0:0:1", "::", "::1", "::ffff:10.0.0.1",
+    "0000:0000:0000:0000:0000:ffff:255.255.255.255", "2001:db8::1::2", "2001:db8:85a3::8a2e:370:7334",
+    "fe80::1%eth0", "hello", "", "1.2.3.4/24"};
+
+/**
+ * The type and bytes inet_pton gives, IPv4 first as IpAddress did before.
+ */
+auto reference(const std::string& address, std::array<uint8_t, 16>& bytes) -> AddressType {
+    if (address.empty()) {
+        return AddressType::Local;
+    }
+    if (1 == inet_pton(AF_INET, address.c_str(), bytes.data())) {
+        return AddressType::IpV4;
+    }
+    if (1 == inet_pton(AF_INET6, address.c_str(), bytes.data())) {
+        return AddressType::IpV6;
+    }
+    return AddressType::Invalid;
+}
+
+} // namespace
+
+// Test the parsed addresses are the ones of inet_pton.
+TEST(IpAddress, testParseMatchesInetPton) {
+    for (const auto& address : Addresses) {
+        std::array<uint8_t, 16> bytes{};
+        const auto type = reference(address, bytes);
+        const IpAddress ip(address);
+        EXPECT_EQ(type, ip.getType()) << address;
+        const std::size_t size = AddressType::IpV4 == type ? 4 : AddressType::IpV6 == type ? 16 : 0;
+        EXPECT_EQ(size, ip.size()) << address;
+        EXPECT_EQ(std::vector<uint8_t>(bytes.begin(), bytes.begin() + size), ip.getBytes()) << address;
+    }
+}
+
+// Test normalized addresses are the ones inet_ntop formats, also when cached.
+TEST(IpAddress, testNormalize) {
+    for (auto pass = 0; pass < 2; ++pass) {
+        for (const auto& address : Addresses) {
+            std::array<uint8_t, 16> bytes{};
+            const auto type = reference(address, bytes);
+            std::string normalized = "unchanged";
+            const auto normalized_type = IpAddress::normalize(address, normalized);
+            if (AddressType::IpV4 != type && AddressType::IpV6 != type) {
+                EXPECT_EQ(AddressType::Invalid, normalized_type) << address;
+                EXPECT_EQ("unchanged", normalized) << address;
+                continue;
+            }
+            std::array<char, INET6_ADDRSTRLEN> text{};
+            inet_ntop(AddressType::IpV4 == type ? AF_INET : AF_INET6, bytes.data(), text.data(), text.size());
+            EXPECT_EQ(type, normalized_type) << address;
+            EXPECT_EQ(std::string(text.data()), normalized) << address;
+            EXPECT_EQ(normalized, IpAddress(address).normalized()) << address;
+            EXPECT_EQ(normalized, BuildUAuthority().setIp(address).build().ip()) << address;
+        }
+    }
+}
+
+// Test addresses built from bytes.
+TEST(IpAddress, testFromBytes) {
+    const std::vector<uint8_t> bytes = {192, 168, 1, 100};
+    const IpAddress ipv4(bytes, AddressType::IpV4);
+    EXPECT_EQ(AddressType::IpV4, ipv4.getType());
+    EXPECT_EQ("192.168.1.100", ipv4.getString());
+    EXPECT_EQ("192.168.1.100", ipv4.normalized());
+
+    const IpAddress too_short(bytes, AddressType::IpV6);
+    EXPECT_EQ(AddressType::Invalid, too_short.getType());
+    EXPECT_EQ(0, too_short.size());
+    EXPECT_EQ("", too_short.getString());
+    EXPECT_EQ("", too_short.normalized());
+}
+
+// Test that getString() is the string the address was built from, valid or not.
+TEST(IpAddress, testGetStringKeepsInput) {
+    for (const auto& address : Addresses) {
+        EXPECT_EQ(address, IpAddress(address).getString()) << address;
+    }
+    const IpAddress ipv6("2001:DB8:0:0:0:0:0:1");
+    EXPECT_EQ("2001:DB8:0:0:0:0:0:1", ipv6.getString());
+    EXPECT_EQ("2001:db8::1", ipv6.normalized());
+
+    const std::string long_text(2 * IpAddress::MaxTextLength, 'a');
+    const IpAddress invalid(long_text);
+    EXPECT_EQ(AddressType::Invalid, invalid.getType());
+    EXPECT_EQ(long_text, invalid.getString());
+    EXPECT_EQ("", invalid.normalized());
+
+    const IpAddress local("");
+    EXPECT_EQ(AddressType::Local, local.getType());
+    EXPECT_EQ("", local.getString());
+}
@@ -737,6 +737,65 @@ TEST(LongUriSerializer, testBuildProtocolUriFromUriPartsWhenUriHasRemoteAuthorit
     assertTrue(LongUriSerializer::serialize(u_uri) == "//vcu.my_car_vin/body.access/1/door");
 }
 
+// Test parse uProtocol uri from a string_view that is not null terminated.
+TEST(LongUriSerializer, testParseProtocolUriFromStringView) {
+    std::string_view buffer = "//vcu.my_car_vin/body.access/1/door.front_left#Door and trailing data";
+    auto u_uri = LongUriSerializer::deserialize(buffer.substr(0, buffer.find(' ')));
+    assertFalse(isLocal(u_uri.authority()));
+    assertTrue("vcu.my_car_vin" == u_uri.authority().name());
+    assertTrue("body.access" == u_uri.entity().name());
+    assertTrue(1 == u_uri.entity().version_major());
+    assertTrue("door" == u_uri.resource().name());
+    assertTrue("front_left" == u_uri.resource().instance());
+    assertTrue("Door" == u_uri.resource().message());
+}
+
+// Test parse uProtocol uri with backslash separators.
+TEST(LongUriSerializer, testParseProtocolUriWithBackslashSeparators) {
+    auto u_uri = LongUriSerializer::deserialize("\\\\vcu.my_car_vin\\body.access\\1\\door");
+    assertFalse(isLocal(u_uri.authority()));
+    assertTrue("vcu.my_car_vin" == u_uri.authority().name());
+    assertTrue("body.access" == u_uri.entity().name());
+    assertTrue("door" == u_uri.resource().name());
+
+    UriTokenizer tokens("\\\\vcu.my_car_vin\\body.access\\1\\door");
+    assertFalse(tokens.isLocal());
+    assertTrue(6 == tokens.size());
+    assertTrue(2 == tokens.firstNotEmpty());
+    assertTrue("door" == tokens[5]);
+}
+
+// Test serialize into a reused string and into a fmt buffer.
+TEST(LongUriSerializer, testSerializeIntoReusedBuffer) {
+    auto remote = BuildUUri().setAutority(BuildUAuthority().setName("VCU", "MY_CAR_VIN").build()).
+            setEntity(BuildUEntity().setName(" body.access ").setMajorVersion(12).setMinorVersion(345).build()).
+            setResource(BuildUResource().setName("door").setInstance("front_left").setMessage("Door").build()).
+            build();
+    auto local = BuildUUri().setAutority(BuildUAuthority().build()).
+            setEntity(BuildUEntity().setName("petapp").setMajorVersion(1).build()).
+            setResource(BuildUResource().setRpcResponse().build()).
+            build();
+
+    std::string out;
+    LongUriSerializer::serialize(remote, out);
+    assertTrue("//vcu.my_car_vin/body.access/12.345/door.front_left#Door" == out);
+    assertTrue(out.size() == LongUriSerializer::serializedLength(remote));
+
+    const auto* data = out.data();
+    LongUriSerializer::serialize(local, out);
+    assertTrue("/petapp/1/rpc.response" == out);
+    assertTrue(out.size() == LongUriSerializer::serializedLength(local));
+    assertTrue(data == out.data());
+
+    LongUriSerializer::serialize(BuildUUri().build(), out);
+    assertTrue(out.empty());
+    assertTrue(0 == LongUriSerializer::serializedLength(BuildUUri().build()));
+
+    fmt::memory_buffer buffer;
+    LongUriSerializer::serialize(remote, buffer);
+    LongUriSerializer::serialize(local, buffer);
+    assertTrue("/petapp/1/rpc.response" == fmt::to_string(buffer));
+}
 
 auto main(int argc, const char** argv) -> int {
     ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
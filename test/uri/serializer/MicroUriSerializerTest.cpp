@@ -22,6 +22,7 @@
  * SPDX-FileCopyrightText: 2023 General Motors GTO LLC
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <array>
 #include <string>
 #include <gtest/gtest.h>
 #include <up-cpp/uri/serializer/MicroUriSerializer.h>
@@ -419,6 +420,101 @@ TEST(UUri, testDeserializeWithWrongSizeForIpv6MicroUri) {
     assertTrue(isEmpty(u_uri));
 }
 
+// Test serializing into a fixed buffer gives the vector serialization.
+TEST(UUri, testSerializeIntoBuffer) {
+    auto u_entity = BuildUEntity().setId(2).setMajorVersion(1).build();
+    auto u_resource = BuildUResource().setID(3).build();
+    std::vector<uprotocol::v1::UAuthority> authorities = {BuildUAuthority().build(),
+                                                          BuildUAuthority().setIp("192.168.1.100").build(),
+                                                          BuildUAuthority().setIp("2001:db8::c0a8:164").build(),
+                                                          BuildUAuthority().setId("vcu.my_car_vin").build()};
+    for (const auto& u_authority : authorities) {
+        auto u_uri = BuildUUri().setAutority(u_authority).setEntity(u_entity).setResource(u_resource).build();
+        std::array<uint8_t, MicroUriSerializer::MaxMicroUriLength> buffer{};
+        auto size = MicroUriSerializer::serializeInto(u_uri, buffer.data(), buffer.size());
+        auto uri = MicroUriSerializer::serialize(u_uri);
+        assertFalse(uri.empty());
+        assertEquals(std::vector<uint8_t>(buffer.begin(), buffer.begin() + size), uri);
+        assertEquals(0, MicroUriSerializer::serializeInto(u_uri, buffer.data(), size - 1));
+        auto u_uri2 = MicroUriSerializer::deserialize(buffer.data(), size);
+        assertEquals(u_uri2.SerializeAsString(), MicroUriSerializer::deserialize(uri).SerializeAsString());
+        assertEquals(u_uri.authority().SerializeAsString(), u_uri2.authority().SerializeAsString());
+    }
+}
+
+// Test serializing an id that does not fit the length byte.
+TEST(UUri, testSerializeTooLongId) {
+    auto u_uri = BuildUUri().
+                 setAutority(BuildUAuthority().setId(std::string(256, 'x')).build()).
+                 setEntity(BuildUEntity().setId(2).build()).
+                 setResource(BuildUResource().setID(3).build()).
+                 build();
+    std::array<uint8_t, MicroUriSerializer::MaxMicroUriLength + 1> buffer{};
+    assertEquals(0, MicroUriSerializer::serializeInto(u_uri, buffer.data(), buffer.size()));
+    assertTrue(MicroUriSerializer::serialize(u_uri).empty());
+}
+
+// Test deserialize of an id micro uri without id bytes.
+TEST(UUri, testDeserializeIdMicroUriWithoutId) {
+    std::array<uint8_t, 8> uri = {0x1, 0x3, 0x0, 0x5, 0x0, 0x2, 0x1, 0x0};
+    auto u_uri = MicroUriSerializer::deserialize(uri.data(), uri.size());
+    assertTrue(isEmpty(u_uri.authority()));
+    assertEquals(u_uri.entity().id(), 2);
+}
+// Test that every batch kernel supported by the CPU decodes as MicroUri::parse.
+TEST(UUri, testBatchKernelsMatchParse) {
+    constexpr std::size_t Count = 77;
+    std::vector<uint8_t> input;
+    for (std::size_t i = 0; i < Count; ++i) {
+        auto u_uri = BuildUUri().
+                     setEntity(BuildUEntity().setId(0x100 + 7 * i).setMajorVersion(i % 5).build()).
+                     setResource(BuildUResource().setID(0x8000 + 3 * i).build()).
+                     build();
+        auto bytes = MicroUriSerializer::serialize(u_uri);
+        input.insert(input.end(), bytes.begin(), bytes.end());
+    }
+    input[3 * MicroUriSerializer::LocalMicroUriLength + 1] = static_cast<uint8_t>(AddressType::Local);
+    input[9 * MicroUriSerializer::LocalMicroUriLength + 0] = 0x2;
+    input[17 * MicroUriSerializer::LocalMicroUriLength + 1] = static_cast<uint8_t>(AddressType::IpV4);
+    input[63 * MicroUriSerializer::LocalMicroUriLength + 1] = static_cast<uint8_t>(AddressType::Id);
+    input[70 * MicroUriSerializer::LocalMicroUriLength + 0] = 0x0;
+
+    auto initial = MicroUriSerializer::getBatchKernel();
+    for (auto kernel : {MicroUriSerializer::BatchKernel::Scalar,
+                        MicroUriSerializer::BatchKernel::Sse41,
+                        MicroUriSerializer::BatchKernel::Avx2}) {
+        if (!MicroUriSerializer::setBatchKernel(kernel)) {
+            continue;
+        }
+        for (std::size_t count : {Count, std::size_t(64), std::size_t(16), std::size_t(1), std::size_t(0)}) {
+            std::vector<uint16_t> entity_ids(count, 1);
+            std::vector<uint8_t> versions(count, 1);
+            std::vector<uint16_t> resource_ids(count, 1);
+            std::vector<uint64_t> invalid((count + 63) / 64, ~uint64_t{0});
+            auto valid = MicroUriSerializer::deserializeLocalBatch(input.data(), count, entity_ids.data(),
+                                                                   versions.data(), resource_ids.data(), invalid.data());
+            std::size_t expected_valid = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                MicroUri uri;
+                bool ok = MicroUri::parse(&input[i * MicroUriSerializer::LocalMicroUriLength],
+                                          MicroUriSerializer::LocalMicroUriLength, uri);
+                expected_valid += ok ? 1 : 0;
+                EXPECT_EQ(!ok, 0 != (invalid[i / 64] & (uint64_t{1} << (i % 64)))) << static_cast<int>(kernel) << " " << i;
+                EXPECT_EQ(ok ? uri.entityId : 0, entity_ids[i]) << static_cast<int>(kernel) << " " << i;
+                EXPECT_EQ(ok ? uri.entityVersion : 0, versions[i]) << static_cast<int>(kernel) << " " << i;
+                EXPECT_EQ(ok ? uri.resourceId : 0, resource_ids[i]) << static_cast<int>(kernel) << " " << i;
+            }
+            if (Count == count) {
+                EXPECT_EQ(Count - 4, expected_valid);
+            }
+            EXPECT_EQ(expected_valid, valid) << static_cast<int>(kernel);
+            if (count % 64 != 0) {
+                EXPECT_EQ(0, invalid.back() >> (count % 64)) << static_cast<int>(kernel);
+            }
+        }
+    }
+    EXPECT_TRUE(MicroUriSerializer::setBatchKernel(initial));
+}
 
 auto main([[maybe_unused]] int argc, [[maybe_unused]] const char** argv) -> int {
     ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string>
+#include <unordered_map>
+#include <gtest/gtest.h>
+#include <up-cpp/uri/builder/BuildUUri.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/tools/UriHash.h>
+
+using namespace uprotocol::uri;
+
+namespace {
+
+auto localUri() -> uprotocol::v1::UUri {
+    return BuildUUri().setAutority(BuildUAuthority().build()).
+            setEntity(BuildUEntity().setName("body.access").setMajorVersion(1).build()).
+            setResource(BuildUResource().setName("door").setInstance("front_left").build()).build();
+}
+
+} // namespace
+
+// Test that equal URIs hash the same.
+TEST(UriHash, testEqualUrisHashTheSame) {
+    const std::string uri = "//vcu.my_car_vin/body.access/1/door.front_left#Door";
+    auto first = LongUriSerializer::deserialize(uri);
+    auto second = LongUriSerializer::deserialize(uri);
+    EXPECT_TRUE(UriEqual()(first, second));
+    EXPECT_EQ(UriHash()(first), UriHash()(second));
+    EXPECT_EQ(UriHash()(first.authority()), UriHash()(second.authority()));
+    EXPECT_EQ(UriHash()(first.entity()), UriHash()(second.entity()));
+    EXPECT_EQ(UriHash()(first.resource()), UriHash()(second.resource()));
+    EXPECT_NE(UriHash()(first), UriHash()(LongUriSerializer::deserialize("/body.access/1/door.front_left#Door")));
+}
+
+// Test that missing fields are not wildcards.
+TEST(UriHash, testMissingFieldsAreNotWildcards) {
+    auto with_version = localUri();
+    auto without_version = localUri();
+    without_version.mutable_entity()->clear_version_major();
+    EXPECT_TRUE(with_version.entity() == without_version.entity());
+    EXPECT_FALSE(UriEqual()(with_version, without_version));
+    EXPECT_FALSE(UriEqual()(with_version.entity(), without_version.entity()));
+
+    auto version_zero = without_version;
+    version_zero.mutable_entity()->set_version_major(0);
+    EXPECT_FALSE(UriEqual()(version_zero, without_version));
+
+    auto with_id = localUri();
+    with_id.mutable_resource()->set_id(7);
+    EXPECT_FALSE(UriEqual()(with_id, localUri()));
+    EXPECT_FALSE(UriEqual()(with_id.resource(), localUri().resource()));
+    EXPECT_NE(UriHash()(with_id), UriHash()(localUri()));
+
+    auto with_ip = localUri();
+    with_ip.mutable_authority()->set_ip(std::string("\x0a\x00\x00\x01", 4));
+    auto with_authority_id = localUri();
+    with_authority_id.mutable_authority()->set_id(std::string("\x0a\x00\x00\x01", 4));
+    EXPECT_FALSE(UriEqual()(with_ip.authority(), with_authority_id.authority()));
+    EXPECT_TRUE(UriEqual()(with_ip, with_ip));
+
+    auto empty_instance = localUri();
+    empty_instance.mutable_resource()->set_instance("");
+    auto no_instance = localUri();
+    no_instance.mutable_resource()->clear_instance();
+    EXPECT_TRUE(UriEqual()(empty_instance, no_instance));
+    EXPECT_EQ(UriHash()(empty_instance), UriHash()(no_instance));
+}
+
+// Test comparing and hashing a UUri with its long format.
+TEST(UriHash, testLongUriLookup) {
+    auto uri = localUri();
+    const auto long_uri = LongUriSerializer::serialize(uri);
+    EXPECT_TRUE(UriEqual()(uri, long_uri));
+    EXPECT_TRUE(UriEqual()(long_uri, uri));
+    EXPECT_EQ(UriHash()(uri), UriHash()(long_uri));
+
+    EXPECT_FALSE(UriEqual()(uri, "/body.access/1/door"));
+    EXPECT_FALSE(UriEqual()(uri, long_uri + "#Door"));
+    EXPECT_FALSE(UriEqual()(uri, ""));
+
+    auto with_id = uri;
+    with_id.mutable_entity()->set_id(2);
+    EXPECT_FALSE(UriEqual()(with_id, long_uri));
+}
+
+// Test that a string equals the UUris of its normalized long form, which
+// the strict comparison can tell apart.
+TEST(UriHash, testLongUriMatchesNormalizedForm) {
+    auto uri = localUri();
+    auto padded = localUri();
+    padded.mutable_entity()->set_name(" body.access ");
+    const auto long_uri = LongUriSerializer::serialize(uri);
+    EXPECT_EQ(long_uri, LongUriSerializer::serialize(padded));
+    EXPECT_TRUE(UriEqual()(uri, long_uri));
+    EXPECT_TRUE(UriEqual()(padded, long_uri));
+    EXPECT_EQ(UriHash()(padded), UriHash()(long_uri));
+    EXPECT_FALSE(UriEqual()(uri, padded));
+}
+
+// Test URIs as keys of an unordered map.
+TEST(UriHash, testUnorderedMapKey) {
+    std::unordered_map<uprotocol::v1::UUri, int, UriHash, UriEqual> routes;
+    routes[localUri()] = 1;
+    routes[LongUriSerializer::deserialize("//vcu.my_car_vin/body.access/1/door")] = 2;
+    routes[localUri()] = 3;
+    ASSERT_EQ(2U, routes.size());
+    EXPECT_EQ(3, routes.at(LongUriSerializer::deserialize("/body.access/1/door.front_left")));
+    EXPECT_EQ(2, routes.at(LongUriSerializer::deserialize("//vcu.my_car_vin/body.access/1/door")));
+    EXPECT_EQ(routes.end(), routes.find(LongUriSerializer::deserialize("/body.access/2/door.front_left")));
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
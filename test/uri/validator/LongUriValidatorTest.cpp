@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+#include <up-cpp/uri/serializer/LongUriSerializer.h>
+#include <up-cpp/uri/tools/Utils.h>
+#include <up-cpp/uri/validator/LongUriValidator.h>
+#include <up-cpp/uri/validator/UriValidator.h>
+
+using namespace uprotocol::uri;
+
+// Reference: valid when deserialize gives a non empty UUri, invalid when it throws.
+static auto validByDeserialize(const std::string &uri) -> bool {
+    try {
+        return !isEmpty(LongUriSerializer::deserialize(uri));
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+static_assert(LongUriValidator::isValid("/body.access/1/door.front_left#Door"));
+static_assert(LongUriValidator::isValid("//vcu.my_car_vin/body.access/1.2/door"));
+static_assert(!LongUriValidator::isValid(""));
+static_assert(!LongUriValidator::isValid("body.access"));
+
+// Test well known URIs.
+TEST(LongUriValidator, testKnownUris) {
+    spdlog::set_level(spdlog::level::off);
+    const std::vector<std::string> valid = {
+        "/body.access",
+        "/body.access/",
+        "/body.access/1",
+        "/body.access/1.1/door.front_left#Door",
+        "\\body.access\\1",
+        "//vcu.my_car_vin",
+        "//vcu.my_car_vin/",
+        "//vcu.my_car_vin/body.access/1/rpc.UpdateDoor",
+        "//vcu.my_car_vin//1",
+        "body.access/",
+        "/ /1",
+        "/ /-0",
+        "/body.access/1x/y",
+        "/body.access/ 2147483647",
+        "/body.access/-2147483648",
+    };
+    const std::vector<std::string> invalid = {
+        "",
+        "/",
+        "//",
+        "///",
+        "////body.access/1",
+        "body.access",
+        "/ /",
+        "/ /-1",
+        "// /body.access",
+        "/ /abc",
+        "/ /2147483648",
+        "/body.access/abc/x",
+        "/body.access/.1",
+        "/body.access/1.",
+        "/body.access/1.x",
+        "//vcu/body.access/2147483648",
+    };
+    for (const auto &uri : valid) {
+        EXPECT_TRUE(LongUriValidator::isValid(uri)) << uri;
+        EXPECT_TRUE(valid_uri(uri)) << uri;
+        EXPECT_TRUE(validByDeserialize(uri)) << uri;
+    }
+    for (const auto &uri : invalid) {
+        EXPECT_FALSE(LongUriValidator::isValid(uri)) << uri;
+        EXPECT_FALSE(valid_uri(uri)) << uri;
+        EXPECT_FALSE(validByDeserialize(uri)) << uri;
+    }
+    spdlog::set_level(spdlog::level::info);
+}
+
+// Differential test: random URIs made of the pieces that matter to the
+// grammar must be valid for the validator exactly when they are for deserialize.
+TEST(LongUriValidator, testSameGrammarAsDeserialize) {
+    spdlog::set_level(spdlog::level::off);
+    const std::vector<std::string> pieces = {
+        "/", "/", "/", "\\", "//", " ", "\t", "body.access", "vcu.my_car_vin", "VCU",
+        "1", "0", "-0", "-1", "+2", " 3", "- 4", "1.2", "3.-4", "1.2.3", ".", "1.", ".5",
+        "x", "1x", "2147483647", "2147483648", "-2147483648", "-2147483649",
+        "99999999999999999999", "rpc.echo#Req", "door.front_left", "#", "#Door", "rpc",
+    };
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<std::size_t> piece(0, pieces.size() - 1);
+    std::uniform_int_distribution<int> length(0, 8);
+    std::size_t valid = 0;
+    constexpr auto Cases = 200000;
+    for (auto n = 0; n < Cases; ++n) {
+        std::string uri;
+        for (auto i = length(rng); i > 0; --i) {
+            uri.append(pieces[piece(rng)]);
+        }
+        auto expected = validByDeserialize(uri);
+        ASSERT_EQ(expected, LongUriValidator::isValid(uri)) << "\"" << uri << "\"";
+        valid += expected ? 1 : 0;
+    }
+    // both outcomes are well covered
+    EXPECT_GT(valid, Cases / 10U);
+    EXPECT_LT(valid, Cases - Cases / 10U);
+    spdlog::set_level(spdlog::level::info);
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
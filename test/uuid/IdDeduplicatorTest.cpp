@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uuid/dedup/IdDeduplicator.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+
+using namespace uprotocol::uuid;
+using Result = IdDeduplicator::Result;
+
+// Builds an id with the given v8 timestamp.
+static RawUuid idAt(uint64_t time, uint64_t n) {
+    return RawUuid{(time << 16) | 0x8000 | (n & 0xfff), 0x8000000000000000ULL | n};
+}
+
+// Test that an id is only new the first time.
+TEST(IdDeduplicator, testDuplicates) {
+    IdDeduplicator dedup;
+    for (auto i = 0; i < 1000; ++i) {
+        auto id = Uuidv8Factory::create();
+        EXPECT_FALSE(dedup.contains(id));
+        EXPECT_EQ(Result::New, dedup.insert(id));
+        EXPECT_TRUE(dedup.contains(id));
+        EXPECT_EQ(Result::Duplicate, dedup.insert(id));
+    }
+    EXPECT_EQ(1000U, dedup.size());
+    EXPECT_EQ(1000U, dedup.duplicates());
+
+    dedup.clear();
+    EXPECT_EQ(0U, dedup.size());
+    EXPECT_EQ(Result::New, dedup.insert(Uuidv8Factory::create()));
+}
+
+// Receives each id at the time of its v8 timestamp, on the manual clock.
+static auto insertAt(IdDeduplicator &dedup, uint64_t now, const RawUuid &id) -> Result {
+    Uuidv8Factory::setManualTime(now);
+    return dedup.insert(id);
+}
+
+// Test that ids leave the cache once they arrived more than the window ago.
+TEST(IdDeduplicator, testWindow) {
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    IdDeduplicator dedup(std::chrono::milliseconds(100));
+    EXPECT_EQ(std::chrono::milliseconds(100), dedup.getWindow());
+    EXPECT_EQ(Result::New, insertAt(dedup, 1000, idAt(1000, 1)));
+    EXPECT_EQ(Result::New, insertAt(dedup, 1050, idAt(1050, 2)));
+    EXPECT_EQ(Result::New, insertAt(dedup, 1100, idAt(1100, 3)));
+    EXPECT_TRUE(dedup.contains(idAt(1000, 1)));
+
+    EXPECT_EQ(Result::New, insertAt(dedup, 1101, idAt(1101, 4)));
+    EXPECT_FALSE(dedup.contains(idAt(1000, 1)));
+    EXPECT_TRUE(dedup.contains(idAt(1050, 2)));
+    EXPECT_EQ(3U, dedup.size());
+
+    // too old to be fully checked, but recorded
+    EXPECT_EQ(Result::Expired, insertAt(dedup, 1101, idAt(1000, 1)));
+    EXPECT_EQ(1U, dedup.expired());
+    EXPECT_EQ(Result::Duplicate, insertAt(dedup, 1101, idAt(1000, 1)));
+    // out of order but within the window
+    EXPECT_EQ(Result::New, insertAt(dedup, 1101, idAt(1020, 5)));
+    EXPECT_EQ(5U, dedup.size());
+
+    dedup.setWindow(std::chrono::milliseconds(10));
+    EXPECT_EQ(Result::New, insertAt(dedup, 1102, idAt(1102, 6)));
+    EXPECT_FALSE(dedup.contains(idAt(1050, 2)));
+    EXPECT_TRUE(dedup.contains(idAt(1020, 5)));
+    EXPECT_EQ(5U, dedup.size());
+    // the ring is in arrival order: 1020 arrived at 1101
+    EXPECT_EQ(Result::New, insertAt(dedup, 1112, idAt(1112, 7)));
+    EXPECT_EQ(2U, dedup.size());
+    EXPECT_FALSE(dedup.contains(idAt(1020, 5)));
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+}
+
+// Test that an id dated in the future does not make later ids expire.
+TEST(IdDeduplicator, testFutureId) {
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    IdDeduplicator dedup(std::chrono::milliseconds(100));
+    EXPECT_EQ(Result::New, insertAt(dedup, 1000, idAt(1000 + 3600000, 1)));
+    EXPECT_EQ(Result::New, insertAt(dedup, 1001, idAt(1001, 2)));
+    EXPECT_EQ(Result::New, insertAt(dedup, 1050, idAt(1040, 3)));
+    EXPECT_EQ(Result::Duplicate, insertAt(dedup, 1050, idAt(1000 + 3600000, 1)));
+    EXPECT_EQ(0U, dedup.expired());
+    // it leaves the cache like an id sent when it arrived
+    EXPECT_EQ(Result::New, insertAt(dedup, 1101, idAt(1101, 4)));
+    EXPECT_FALSE(dedup.contains(idAt(1000 + 3600000, 1)));
+    EXPECT_TRUE(dedup.contains(idAt(1001, 2)));
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+}
+
+// Test that the ids of a sender whose clock is behind are reported as
+// expired, not as duplicates, and are still deduplicated.
+TEST(IdDeduplicator, testSenderClockBehind) {
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    IdDeduplicator dedup(std::chrono::milliseconds(100));
+    for (uint64_t n = 0; n < 10; ++n) {
+        EXPECT_EQ(Result::Expired, insertAt(dedup, 1000000 + n, idAt(5 + n, n)));
+        EXPECT_EQ(Result::Duplicate, insertAt(dedup, 1000000 + n, idAt(5 + n, n)));
+    }
+    EXPECT_EQ(10U, dedup.expired());
+    EXPECT_EQ(10U, dedup.duplicates());
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+}
+
+// Test that the memory stays bounded: the oldest ids are evicted.
+TEST(IdDeduplicator, testCapacity) {
+    IdDeduplicator dedup(std::chrono::hours(1), 1000);
+    EXPECT_EQ(1024U, dedup.capacity());
+    std::vector<RawUuid> ids(100000);
+    Uuidv8Factory::createBatch(ids.size(), ids.data());
+    for (const auto &id : ids) {
+        EXPECT_EQ(Result::New, dedup.insert(id));
+    }
+    EXPECT_EQ(1024U, dedup.size());
+    for (std::size_t i = ids.size() - 1024; i < ids.size(); ++i) {
+        EXPECT_TRUE(dedup.contains(ids[i]));
+    }
+}
+
+// Test that the measured false positive rate stays under the reported one.
+TEST(IdDeduplicator, testFalsePositiveRate) {
+    IdDeduplicator dedup(std::chrono::hours(1), 1 << 16);
+    EXPECT_EQ(0.0, dedup.falsePositiveRate());
+    std::mt19937_64 rng(42);
+    for (auto i = 0; i < (1 << 16); ++i) {
+        dedup.insert(idAt(1000, rng()));
+    }
+    auto rate = dedup.falsePositiveRate();
+    EXPECT_GT(rate, 0.0);
+    EXPECT_LT(rate, 1e-8);
+
+    uint64_t positives = 0;
+    constexpr uint64_t Probes = 1000000;
+    for (uint64_t i = 0; i < Probes; ++i) {
+        positives += dedup.contains(idAt(1000, rng())) ? 1 : 0;
+    }
+    EXPECT_LE(positives, 1U);
+    RecordProperty("false_positive_rate", std::to_string(rate));
+}
+
+// Test that lock-free readers never miss ids while a writer inserts and
+// relocates fingerprints.
+TEST(IdDeduplicator, testConcurrentReaders) {
+    IdDeduplicator dedup(std::chrono::hours(1), 1 << 16);
+    std::vector<RawUuid> kept(1000);
+    Uuidv8Factory::createBatch(kept.size(), kept.data());
+    for (const auto &id : kept) {
+        dedup.insert(id);
+    }
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> misses{0};
+    std::vector<std::thread> readers;
+    for (auto t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            while (running) {
+                for (const auto &id : kept) {
+                    misses += dedup.contains(id) ? 0 : 1;
+                }
+            }
+        });
+    }
+    // fill up to the capacity, with many cuckoo moves, without evicting kept
+    std::vector<RawUuid> ids((1 << 16) - kept.size());
+    Uuidv8Factory::createBatch(ids.size(), ids.data());
+    for (const auto &id : ids) {
+        dedup.insert(id);
+    }
+    running = false;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(1U << 16, dedup.size());
+    EXPECT_EQ(0U, misses);
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
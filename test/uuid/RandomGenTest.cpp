@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <set>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <up-cpp/uuid/factory/RandomGen.h>
+
+// Test that GenerateRandom never returns 0 and does not repeat itself.
+TEST(RandomGenerator, testGenerateRandom) {
+    std::set<uint64_t> values;
+    for (auto i = 0; i < 1000; ++i) {
+        auto value = RandomGenerator::GenerateRandom();
+        EXPECT_NE(0U, value);
+        values.insert(value);
+    }
+    EXPECT_EQ(1000U, values.size());
+}
+
+// Test that fill writes exactly the requested number of values.
+TEST(RandomGenerator, testFill) {
+    std::vector<uint64_t> values(130, 0);
+    RandomGenerator::fill(values.data(), 128);
+    EXPECT_EQ(128U, std::set<uint64_t>(values.begin(), values.begin() + 128).size());
+    EXPECT_EQ(0U, values[128]);
+    EXPECT_EQ(0U, values[129]);
+}
+
+// Test that each thread has its own sequence.
+TEST(RandomGenerator, testThreadsHaveTheirOwnSequence) {
+    std::vector<uint64_t> values(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < values.size(); ++t) {
+        threads.emplace_back([&values, t]() { values[t] = RandomGenerator::GenerateRandom(); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(values.size(), std::set<uint64_t>(values.begin(), values.end()).size());
+}
+
+// Test that a forked child does not replay the sequence of its parent.
+TEST(RandomGenerator, testForkReseeds) {
+    (void)RandomGenerator::GenerateRandom();
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    auto pid = fork();
+    ASSERT_NE(-1, pid);
+    if (0 == pid) {
+        uint64_t value = RandomGenerator::GenerateRandom();
+        auto written = write(fds[1], &value, sizeof(value));
+        _exit(sizeof(value) == written ? 0 : 1);
+    }
+    uint64_t child_value = 0;
+    auto bytes = read(fds[0], &child_value, sizeof(child_value));
+    int status = 0;
+    waitpid(pid, &status, 0);
+    close(fds[0]);
+    close(fds[1]);
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(child_value)), bytes);
+    EXPECT_NE(RandomGenerator::GenerateRandom(), child_value);
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
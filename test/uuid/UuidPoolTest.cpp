@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uuid/factory/UuidPool.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+#include <up-cpp/uuid/serializer/UuidSerializer.h>
+
+using namespace uprotocol::uuid;
+
+// Wait until the background thread filled the ring.
+static void waitForRefill() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+
+// Test that the capacity is rounded up to a power of 2.
+TEST(UuidPool, testCapacity) {
+    UuidPool pool(100);
+    EXPECT_EQ(128U, pool.capacity());
+}
+
+// Test that a filled pool serves UUIDs without generating them inline.
+TEST(UuidPool, testTakeFromRing) {
+    UuidPool pool(256);
+    waitForRefill();
+    for (auto i = 0; i < 256; ++i) {
+        auto id = pool.take();
+        EXPECT_EQ(8U, (id.msb >> 12) & 0xf);
+    }
+    EXPECT_EQ(0U, pool.dryCount());
+}
+
+// Test that an empty pool falls back to inline generation and counts it.
+TEST(UuidPool, testDryFallback) {
+    UuidPool pool(2, std::chrono::seconds(10));
+    waitForRefill();
+    std::set<uint64_t> values;
+    for (auto i = 0; i < 10; ++i) {
+        values.insert(pool.take().msb);
+    }
+    EXPECT_EQ(10U, values.size());
+    EXPECT_EQ(8U, pool.dryCount());
+}
+
+// Test that the UUIDs are increasing, including across inline fallbacks.
+TEST(UuidPool, testOrdering) {
+    UuidPool pool(64, std::chrono::microseconds(1));
+    RawUuid last{0, 0};
+    for (auto i = 0; i < 200000; ++i) {
+        auto id = pool.take();
+        ASSERT_GT(id.msb, last.msb);
+        last = id;
+    }
+}
+
+// Test that an inline UUID generated concurrently never lets an older one through.
+TEST(UuidPool, testOrderingWithOtherSenders) {
+    UuidPool pool(64, std::chrono::microseconds(1));
+    std::atomic<bool> running{true};
+    std::thread other([&running]() {
+        while (running) {
+            Uuidv8Factory::create();
+        }
+    });
+    uint64_t last = 0;
+    for (auto i = 0; i < 100000; ++i) {
+        auto id = pool.take();
+        ASSERT_GT(id.msb, last);
+        last = id.msb;
+    }
+    running = false;
+    other.join();
+}
+
+// Test that UUIDs pre-generated before the sender went idle are regenerated.
+TEST(UuidPool, testMaxAge) {
+    const auto time = Uuidv8Factory::now();
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    Uuidv8Factory::setManualTime(time);
+    {
+        UuidPool pool(16, std::chrono::milliseconds(1), std::chrono::milliseconds(2));
+        waitForRefill();
+        EXPECT_GE(pool.take().getTime(), time);
+        Uuidv8Factory::setManualTime(time + 2);
+        waitForRefill();
+        EXPECT_GE(pool.take().getTime(), time);
+        waitForRefill();
+        EXPECT_EQ(0U, pool.expiredCount());
+
+        Uuidv8Factory::setManualTime(time + 60000);
+        waitForRefill();
+        EXPECT_EQ(16U, pool.expiredCount());
+        auto id = pool.take();
+        EXPECT_EQ(time + 60000, id.getTime());
+        EXPECT_EQ(0U, pool.dryCount());
+    }
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+}
+
+// Test that a default pool serves recent UUIDs to a sender taking one now and then.
+TEST(UuidPool, testIdleSender) {
+    UuidPool pool;
+    waitForRefill();
+    for (auto gap : {2, 10, 150, 150}) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(gap));
+        auto now = Uuidv8Factory::now();
+        auto id = pool.take();
+        EXPECT_LE(now, id.getTime() + 2 * UuidPool::DefaultMaxAge.count());
+    }
+    EXPECT_EQ(0U, pool.dryCount());
+}
+
+// Test takeUUID.
+TEST(UuidPool, testTakeUUID) {
+    UuidPool pool;
+    auto uuid = pool.takeUUID();
+    EXPECT_NE(0U, UuidSerializer::getTime(uuid));
+    EXPECT_NE(0U, uuid.lsb());
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
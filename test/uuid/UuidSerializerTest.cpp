@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <up-cpp/uuid/datamodel/UuidCompare.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+#include <up-cpp/uuid/serializer/UuidLiteral.h>
+#include <up-cpp/uuid/serializer/UuidSerializer.h>
+
+using namespace uprotocol::uuid;
+using namespace uprotocol::uuid::literals;
+
+// Test that the fixed buffer overloads match the allocating ones.
+TEST(UuidSerializer, testFixedBuffersMatchAllocatingFunctions) {
+    for (auto i = 0; i < 100; ++i) {
+        auto uuid = Uuidv8Factory::create();
+
+        char str[UuidSerializer::StringLength];
+        UuidSerializer::serializeToString(uuid, str);
+        EXPECT_EQ(UuidSerializer::serializeToString(uuid), std::string(str, sizeof(str)));
+
+        std::array<uint8_t, UuidSerializer::BytesLength> bytes{};
+        UuidSerializer::serializeToBytes(uuid, bytes);
+        auto vec = UuidSerializer::serializeToBytes(uuid);
+        EXPECT_TRUE(std::equal(vec.begin(), vec.end(), bytes.begin(), bytes.end()));
+
+        auto from_bytes = UuidSerializer::deserializeFromBytes(bytes);
+        EXPECT_EQ(uuid.msb(), from_bytes.msb());
+        EXPECT_EQ(uuid.lsb(), from_bytes.lsb());
+
+        auto from_string = UuidSerializer::deserializeFromString(std::string_view(str, sizeof(str)));
+        EXPECT_EQ(uuid.msb(), from_string.msb());
+        EXPECT_EQ(uuid.lsb(), from_string.lsb());
+    }
+}
+
+// Test the String format of a known UUID.
+TEST(UuidSerializer, testKnownString) {
+    const std::string str = "0080b636-8303-8701-8ebe-7a9a9e767a9f";
+    RawUuid raw{};
+    EXPECT_TRUE(UuidSerializer::deserializeFromString(str, raw));
+    char out[UuidSerializer::StringLength];
+    UuidSerializer::serializeToString(raw, out);
+    EXPECT_EQ(str, std::string(out, sizeof(out)));
+
+    auto upper = UuidSerializer::deserializeFromString("0080B636-8303-8701-8EBE-7A9A9E767A9F");
+    EXPECT_EQ(raw.msb, upper.msb());
+    EXPECT_EQ(raw.lsb, upper.lsb());
+
+    auto no_dashes = UuidSerializer::deserializeFromString("0080b636830387018ebe7a9a9e767a9f");
+    EXPECT_EQ(raw.msb, no_dashes.msb());
+    EXPECT_EQ(raw.lsb, no_dashes.lsb());
+}
+
+// Test invalid Strings.
+TEST(UuidSerializer, testInvalidString) {
+    RawUuid raw{};
+    EXPECT_FALSE(UuidSerializer::deserializeFromString("0080b636-8303-8701-8ebe-7a9a9e767a9f-1abc", raw));
+    EXPECT_FALSE(UuidSerializer::deserializeFromString("0080b636-8303-8701-8ebe-7a9a9e767a9g", raw));
+    auto uuid = UuidSerializer::deserializeFromString("test");
+    EXPECT_EQ(0U, uuid.msb());
+    EXPECT_EQ(0U, uuid.lsb());
+}
+
+// Test that missing hex digits are taken as 0, as they always were.
+TEST(UuidSerializer, testShortString) {
+    RawUuid raw{};
+    EXPECT_TRUE(UuidSerializer::deserializeFromString("", raw));
+    EXPECT_EQ(0U, raw.msb);
+    EXPECT_EQ(0U, raw.lsb);
+    EXPECT_TRUE(UuidSerializer::deserializeFromString("ab1", raw));
+    EXPECT_EQ(0x10abU, raw.msb);
+    EXPECT_EQ(0U, raw.lsb);
+}
+
+// Test that every bulk kernel supported by the CPU gives the same output as the single UUID functions.
+TEST(UuidSerializer, testBulkKernelsMatchSingleFunctions) {
+    constexpr std::size_t Count = 37;
+    std::vector<RawUuid> uuids(Count);
+    Uuidv8Factory::createBatch(Count, uuids.data());
+    uuids[3] = RawUuid{0, 0};
+    uuids[4] = RawUuid{UINT64_MAX, UINT64_MAX};
+    uuids[5] = RawUuid{0x0123456789abcdefULL, 0xfedcba9876543210ULL};
+
+    std::string expected;
+    for (const auto &uuid : uuids) {
+        char str[UuidSerializer::StringLength];
+        UuidSerializer::serializeToString(uuid, str);
+        expected.append(str, sizeof(str));
+    }
+    // not canonical: upper case is accepted, misplaced dash and invalid digit are not
+    std::string input = expected;
+    for (auto i = 0; i < 8; ++i) {
+        input[6 * UuidSerializer::StringLength + i] = std::toupper(input[6 * UuidSerializer::StringLength + i]);
+    }
+    input[7 * UuidSerializer::StringLength + 13] = '0';
+    input[8 * UuidSerializer::StringLength + 35] = 'g';
+    input[9 * UuidSerializer::StringLength + 0] = '/';
+
+    auto initial = UuidSerializer::getHexKernel();
+    for (auto kernel : {UuidSerializer::HexKernel::Scalar,
+                        UuidSerializer::HexKernel::Sse41,
+                        UuidSerializer::HexKernel::Avx2}) {
+        if (!UuidSerializer::setHexKernel(kernel)) {
+            continue;
+        }
+        for (std::size_t count : {Count, std::size_t(1), std::size_t(2), std::size_t(0)}) {
+            std::string out(count * UuidSerializer::StringLength, '\0');
+            UuidSerializer::serializeToStrings(uuids.data(), count, out.data());
+            EXPECT_EQ(expected.substr(0, out.size()), out) << static_cast<int>(kernel);
+        }
+
+        std::vector<RawUuid> decoded(Count, RawUuid{1, 1});
+        EXPECT_EQ(Count - 3, UuidSerializer::deserializeFromStrings(input.data(), Count, decoded.data()));
+        for (std::size_t i = 0; i < Count; ++i) {
+            bool invalid = (7 == i || 8 == i || 9 == i);
+            EXPECT_EQ(invalid ? 0 : uuids[i].msb, decoded[i].msb) << static_cast<int>(kernel) << " " << i;
+            EXPECT_EQ(invalid ? 0 : uuids[i].lsb, decoded[i].lsb) << static_cast<int>(kernel) << " " << i;
+        }
+    }
+    EXPECT_TRUE(UuidSerializer::setHexKernel(initial));
+}
+
+// Test that every bulk kernel accepts and rejects the same single character mutations.
+TEST(UuidSerializer, testBulkKernelsAgreeOnMutations) {
+    constexpr std::size_t Count = 3;
+    std::vector<RawUuid> uuids(Count);
+    Uuidv8Factory::createBatch(Count, uuids.data());
+    std::string canonical(Count * UuidSerializer::StringLength, '\0');
+    UuidSerializer::serializeToStrings(uuids.data(), Count, canonical.data());
+
+    const char mutations[] = {'-', '0', '9', 'a', 'F', 'g', 'G', '/', ':', '@', '`', ' ', '\0', '\x80', '\xff'};
+    auto initial = UuidSerializer::getHexKernel();
+    // the mutated string is in each lane of the AVX2 kernel and in the remainder
+    for (std::size_t target = 0; target < Count; ++target) {
+        for (std::size_t pos = 0; pos < UuidSerializer::StringLength; ++pos) {
+            for (auto c : mutations) {
+                // exact size so that reading past the last string is caught by sanitizers
+                std::vector<char> input(canonical.begin(), canonical.end());
+                input[target * UuidSerializer::StringLength + pos] = c;
+                bool dash = (8 == pos || 13 == pos || 18 == pos || 23 == pos);
+                bool expected = dash ? ('-' == c) : (0 != std::isxdigit(static_cast<unsigned char>(c)));
+
+                std::vector<RawUuid> reference(Count);
+                EXPECT_TRUE(UuidSerializer::setHexKernel(UuidSerializer::HexKernel::Scalar));
+                auto valid = UuidSerializer::deserializeFromStrings(input.data(), Count, reference.data());
+                ASSERT_EQ(expected ? Count : Count - 1, valid) << target << " " << pos << " " << int(c);
+
+                for (auto kernel : {UuidSerializer::HexKernel::Sse41, UuidSerializer::HexKernel::Avx2}) {
+                    if (!UuidSerializer::setHexKernel(kernel)) {
+                        continue;
+                    }
+                    std::vector<RawUuid> decoded(Count, RawUuid{1, 1});
+                    EXPECT_EQ(valid, UuidSerializer::deserializeFromStrings(input.data(), Count, decoded.data()))
+                        << static_cast<int>(kernel) << " " << target << " " << pos << " " << int(c);
+                    EXPECT_EQ(reference, decoded)
+                        << static_cast<int>(kernel) << " " << target << " " << pos << " " << int(c);
+                }
+            }
+        }
+    }
+    EXPECT_TRUE(UuidSerializer::setHexKernel(initial));
+}
+
+// Test the time, counter and order of raw UUIDs at compile time.
+static_assert(RawUuid{0x018f3a2b4c5d8123ULL, 1}.getTime() == 0x018f3a2b4c5dULL);
+static_assert(RawUuid{0x018f3a2b4c5d8123ULL, 1}.getCount() == 0x123);
+static_assert(RawUuid{1, 2} < RawUuid{1, 3});
+static_assert(RawUuid{1, 9} < RawUuid{2, 0});
+static_assert(RawUuid{1, 2} == RawUuid{1, 2});
+static_assert(std::hash<RawUuid>{}(RawUuid{1, 2}) != std::hash<RawUuid>{}(RawUuid{2, 2}));
+
+// Test that the generated UUIDs are ordered and hashed without collisions.
+TEST(UuidSerializer, testOrderAndHash) {
+    std::vector<UUID> uuids;
+    std::vector<RawUuid> raws;
+    for (auto i = 0; i < 10000; ++i) {
+        auto uuid = Uuidv8Factory::create();
+        RawUuid raw{uuid.msb(), uuid.lsb()};
+        EXPECT_EQ(UuidSerializer::getTime(uuid), raw.getTime());
+        EXPECT_EQ(UuidSerializer::getCount(uuid), raw.getCount());
+        uuids.push_back(uuid);
+        raws.push_back(raw);
+    }
+    EXPECT_TRUE(std::is_sorted(uuids.begin(), uuids.end()));
+    EXPECT_TRUE(std::is_sorted(raws.begin(), raws.end()));
+    EXPECT_TRUE(uuids.front() < uuids.back());
+    EXPECT_TRUE(uuids.front() != uuids.back());
+    EXPECT_TRUE(uuids.front() == uuids.front());
+
+    std::unordered_set<UUID> uuidSet(uuids.begin(), uuids.end());
+    std::unordered_set<RawUuid> rawSet(raws.begin(), raws.end());
+    EXPECT_EQ(uuids.size(), uuidSet.size());
+    EXPECT_EQ(raws.size(), rawSet.size());
+    EXPECT_EQ(1U, uuidSet.count(uuids[42]));
+    EXPECT_EQ(std::hash<UUID>{}(uuids[42]), std::hash<RawUuid>{}(raws[42]));
+
+    // a single bit of the msb changes about half the bits of the hash
+    auto diff = std::hash<RawUuid>{}(RawUuid{2, 7}) ^ std::hash<RawUuid>{}(RawUuid{3, 7});
+    EXPECT_GT(__builtin_popcountll(diff), 16);
+}
+
+// Test UUID literals at compile time.
+static constexpr RawUuid KnownUuid = "0080b636-8303-8701-8ebe-7a9a9e767a9f"_uuid;
+static_assert(0x0187038336b68000ULL == KnownUuid.msb);
+static_assert(0x9f7a769e9a7abe8eULL == KnownUuid.lsb);
+static_assert(KnownUuid == "0080B636-8303-8701-8EBE-7A9A9E767A9F"_uuid);
+static constexpr RawUuid KnownTable[] = {"00000000-0000-0000-0000-000000000001"_uuid,
+                                         "ffffffff-ffff-ffff-ffff-ffffffffffff"_uuid};
+static_assert(0x0100000000000000ULL == KnownTable[0].lsb && 0 == KnownTable[0].msb);
+static_assert(~0ULL == KnownTable[1].msb);
+
+// Test that literals match the run time parser.
+TEST(UuidSerializer, testLiteral) {
+    for (auto i = 0; i < 100; ++i) {
+        auto uuid = Uuidv8Factory::create();
+        auto str = UuidSerializer::serializeToString(uuid);
+        RawUuid raw{};
+        EXPECT_TRUE(parseUuid(str, raw));
+        EXPECT_EQ(uuid.msb(), raw.msb);
+        EXPECT_EQ(uuid.lsb(), raw.lsb);
+    }
+    RawUuid known{};
+    EXPECT_TRUE(UuidSerializer::deserializeFromString("0080b636-8303-8701-8ebe-7a9a9e767a9f", known));
+    EXPECT_EQ(known, KnownUuid);
+}
+
+// Test that the parser only accepts canonical strings.
+TEST(UuidSerializer, testLiteralInvalid) {
+    RawUuid raw{7, 7};
+    EXPECT_FALSE(parseUuid("0080b636830387018ebe7a9a9e767a9f", raw));
+    EXPECT_FALSE(parseUuid("0080b636-8303-8701-8ebe-7a9a9e767a9", raw));
+    EXPECT_FALSE(parseUuid("0080b636-8303-8701-8ebe-7a9a9e767a9g", raw));
+    EXPECT_FALSE(parseUuid("0080b636-8303-8701-8ebe_7a9a9e767a9f", raw));
+    EXPECT_FALSE(parseUuid("0080b636-8303-8701-8ebe-7a9a9e767a9f0", raw));
+    EXPECT_EQ(7U, raw.msb);
+    EXPECT_THROW(parseUuid(std::string_view("test")), std::invalid_argument);
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}
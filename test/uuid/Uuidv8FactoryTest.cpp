@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2024 General Motors GTO LLC
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileCopyrightText: 2024 General Motors GTO LLC
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <set>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <up-cpp/uuid/factory/Uuidv8Factory.h>
+
+using namespace uprotocol::uuid;
+
+static auto isIncreasing(const std::vector<RawUuid> &ids) -> bool {
+    return std::adjacent_find(ids.begin(), ids.end(), [](const RawUuid &a, const RawUuid &b) {
+        return a.msb >= b.msb;
+    }) == ids.end();
+}
+
+// Test that create() builds a version 8 UUID with the factory node bits.
+TEST(Uuidv8Factory, testCreate) {
+    auto uuid = Uuidv8Factory::create();
+    EXPECT_EQ(8U, (uuid.msb() >> 12) & 0xf);
+    EXPECT_EQ(2U, uuid.lsb() >> 62);
+
+    RawUuid id;
+    Uuidv8Factory::createBatch(1, &id);
+    EXPECT_EQ(uuid.lsb(), id.lsb);
+    EXPECT_LT(uuid.msb(), id.msb);
+    auto copy = Uuidv8Factory::toUUID(id);
+    EXPECT_EQ(id.msb, copy.msb());
+    EXPECT_EQ(id.lsb, copy.lsb());
+}
+
+// Test that a batch larger than the counter of one tick stays increasing.
+TEST(Uuidv8Factory, testCreateBatchIsIncreasing) {
+    std::vector<RawUuid> ids(10000);
+    Uuidv8Factory::createBatch(ids.size(), ids.data());
+    EXPECT_TRUE(isIncreasing(ids));
+    for (const auto &id : ids) {
+        EXPECT_EQ(8U, (id.msb >> 12) & 0xf);
+    }
+}
+
+// Test that batches of concurrent threads are unique and each one increasing.
+TEST(Uuidv8Factory, testCreateBatchConcurrently) {
+    constexpr auto Threads = 4;
+    constexpr auto Batches = 100;
+    constexpr auto BatchSize = 50;
+    std::vector<std::vector<RawUuid>> ids(Threads, std::vector<RawUuid>(Batches * BatchSize));
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < Threads; ++t) {
+        threads.emplace_back([&ids, t]() {
+            for (auto b = 0; b < Batches; ++b) {
+                Uuidv8Factory::createBatch(BatchSize, ids[t].data() + b * BatchSize);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::set<uint64_t> unique;
+    for (const auto &thread_ids : ids) {
+        EXPECT_TRUE(isIncreasing(thread_ids));
+        for (const auto &id : thread_ids) {
+            unique.insert(id.msb);
+        }
+    }
+    EXPECT_EQ(static_cast<std::size_t>(Threads * Batches * BatchSize), unique.size());
+}
+
+// Test that the thread local mode gives each thread its own rand_b and counter.
+TEST(Uuidv8Factory, testThreadLocalMode) {
+    constexpr auto Threads = 4;
+    constexpr auto Ids = 5000;
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::ThreadLocal);
+    std::vector<std::vector<RawUuid>> ids(Threads, std::vector<RawUuid>(Ids));
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < Threads; ++t) {
+        threads.emplace_back([&ids, t]() {
+            for (auto i = 0; i < Ids; ++i) {
+                auto uuid = Uuidv8Factory::create();
+                ids[t][i] = RawUuid{uuid.msb(), uuid.lsb()};
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::Shared);
+
+    std::set<std::pair<uint64_t, uint64_t>> unique;
+    std::set<uint64_t> lsbs;
+    for (const auto &thread_ids : ids) {
+        EXPECT_TRUE(isIncreasing(thread_ids));
+        for (const auto &id : thread_ids) {
+            EXPECT_EQ(thread_ids.front().lsb, id.lsb);
+            EXPECT_EQ(2U, id.lsb >> 62);
+            unique.emplace(id.msb, id.lsb);
+        }
+        lsbs.insert(thread_ids.front().lsb);
+    }
+    EXPECT_EQ(static_cast<std::size_t>(Threads), lsbs.size());
+    EXPECT_EQ(static_cast<std::size_t>(Threads * Ids), unique.size());
+}
+
+// Test that a child forked from a generating thread does not replay its ids.
+TEST(Uuidv8Factory, testThreadLocalModeAfterFork) {
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::ThreadLocal);
+    auto before = Uuidv8Factory::create();
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    auto pid = fork();
+    ASSERT_NE(-1, pid);
+    if (0 == pid) {
+        RawUuid id;
+        Uuidv8Factory::createBatch(1, &id);
+        auto written = write(fds[1], &id, sizeof(id));
+        _exit(sizeof(id) == written ? 0 : 1);
+    }
+    RawUuid child_id{0, 0};
+    auto bytes = read(fds[0], &child_id, sizeof(child_id));
+    int status = 0;
+    waitpid(pid, &status, 0);
+    close(fds[0]);
+    close(fds[1]);
+    RawUuid parent_id;
+    Uuidv8Factory::createBatch(1, &parent_id);
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::Shared);
+
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(child_id)), bytes);
+    EXPECT_EQ(before.lsb(), parent_id.lsb);
+    EXPECT_NE(parent_id.lsb, child_id.lsb);
+    EXPECT_EQ(2U, child_id.lsb >> 62);
+}
+
+// Stress test of the Borrow overflow strategy: tens of millions of ids,
+// way above the 4096 ids per millisecond of one counter, must stay unique.
+TEST(Uuidv8Factory, testBorrowOverflowStress) {
+    constexpr uint64_t Ids = 20000000;
+    constexpr std::size_t BatchSize = 4096;
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Borrow);
+    std::vector<RawUuid> ids(BatchSize);
+    uint64_t last_msb = 0;
+    uint64_t not_increasing = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t done = 0; done < Ids; done += BatchSize) {
+        Uuidv8Factory::createBatch(BatchSize, ids.data());
+        for (const auto &id : ids) {
+            not_increasing += (id.msb <= last_msb) ? 1 : 0;
+            not_increasing += (((id.msb >> 12) & 0xf) != 8) ? 1 : 0;
+            last_msb = id.msb;
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Wait);
+
+    EXPECT_EQ(0U, not_increasing);
+    // waiting for the clock would take at least Ids / 4096 milliseconds
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    EXPECT_LT(static_cast<uint64_t>(elapsed_ms), Ids / 4096);
+    RecordProperty("ids_per_second", std::to_string(Ids * 1000 / std::max<uint64_t>(elapsed_ms, 1)));
+}
+
+// Test that concurrent threads borrowing ticks still get unique ids.
+TEST(Uuidv8Factory, testBorrowOverflowConcurrently) {
+    constexpr auto Threads = 4;
+    constexpr auto Ids = 20000;
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Borrow);
+    std::vector<std::vector<RawUuid>> ids(Threads, std::vector<RawUuid>(Ids));
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < Threads; ++t) {
+        threads.emplace_back([&ids, t]() {
+            Uuidv8Factory::createBatch(Ids, ids[t].data());
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Wait);
+
+    std::set<uint64_t> unique;
+    for (const auto &thread_ids : ids) {
+        EXPECT_TRUE(isIncreasing(thread_ids));
+        for (const auto &id : thread_ids) {
+            unique.insert(id.msb);
+        }
+    }
+    EXPECT_EQ(static_cast<std::size_t>(Threads * Ids), unique.size());
+}
+
+static auto systemMs() -> uint64_t {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Test that the real time clocks give the Unix time.
+TEST(Uuidv8Factory, testRealtimeClocks) {
+    for (auto clock : {Uuidv8Factory::Clock::Realtime,
+                       Uuidv8Factory::Clock::RealtimeCoarse,
+                       Uuidv8Factory::Clock::Cached}) {
+        Uuidv8Factory::setClock(clock);
+        EXPECT_EQ(clock, Uuidv8Factory::getClock());
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        auto before = systemMs();
+        auto now = Uuidv8Factory::now();
+        auto after = systemMs();
+        EXPECT_LE(before, now + 20);
+        EXPECT_GE(after + 1, now);
+    }
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+}
+
+// Test that the cached clock moves and keeps moving in a forked child.
+TEST(Uuidv8Factory, testCachedClock) {
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Cached);
+    auto first = Uuidv8Factory::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_LT(first, Uuidv8Factory::now());
+
+    auto pid = fork();
+    if (0 == pid) {
+        Uuidv8Factory::now();
+        auto start = Uuidv8Factory::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        _exit(Uuidv8Factory::now() > start ? 0 : 1);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+}
+
+// Test that the manual clock gives deterministic msb. Uses a thread of its
+// own in Mode::ThreadLocal so that no previous id is in the future.
+TEST(Uuidv8Factory, testManualClock) {
+    constexpr uint64_t Time = 0x123456789aULL;
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::ThreadLocal);
+    Uuidv8Factory::setManualTime(Time);
+    std::vector<RawUuid> ids(3);
+    std::thread([&ids]() {
+        Uuidv8Factory::createBatch(2, ids.data());
+        Uuidv8Factory::setManualTime(Time + 1);
+        Uuidv8Factory::createBatch(1, ids.data() + 2);
+    }).join();
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::Shared);
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+
+    EXPECT_EQ((Time << 16) | 0x8000, ids[0].msb);
+    EXPECT_EQ((Time << 16) | 0x8001, ids[1].msb);
+    EXPECT_EQ(((Time + 1) << 16) | 0x8000, ids[2].msb);
+    EXPECT_EQ(Time + 1, ids[2].getTime());
+}
+
+// Test that an exhausted counter does not wait for a clock stepped back,
+// which could take as long as the step.
+TEST(Uuidv8Factory, testWaitWhenClockStepsBack) {
+    constexpr uint64_t Time = 0x123456789aULL;
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::ThreadLocal);
+    Uuidv8Factory::setOverflow(Uuidv8Factory::Overflow::Wait);
+    Uuidv8Factory::setManualTime(Time);
+    std::vector<RawUuid> ids(4097);
+    auto generated = std::async(std::launch::async, [&ids]() {
+        Uuidv8Factory::createBatch(4096, ids.data());
+        Uuidv8Factory::setManualTime(Time - 60000);
+        Uuidv8Factory::createBatch(1, ids.data() + 4096);
+    });
+    auto status = generated.wait_for(std::chrono::seconds(5));
+    if (std::future_status::ready != status) {
+        // unblock the generating thread
+        Uuidv8Factory::setManualTime(Time + 1);
+    }
+    generated.wait();
+    Uuidv8Factory::setMode(Uuidv8Factory::Mode::Shared);
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+
+    ASSERT_EQ(std::future_status::ready, status);
+    EXPECT_TRUE(isIncreasing(ids));
+    EXPECT_EQ(((Time + 1) << 16) | 0x8000, ids[4096].msb);
+}
+
+// Test that the shared generator does not wait for a clock stepped back
+// either, starting from the last id generated with the default clock.
+TEST(Uuidv8Factory, testSharedModeWhenClockStepsBack) {
+    EXPECT_EQ(Uuidv8Factory::Clock::Realtime, Uuidv8Factory::getClock());
+    EXPECT_EQ(Uuidv8Factory::Overflow::Wait, Uuidv8Factory::getOverflow());
+    RawUuid last;
+    Uuidv8Factory::createBatch(1, &last);
+    const uint64_t time = last.getTime() + 1;
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Manual);
+    Uuidv8Factory::setManualTime(time);
+    std::vector<RawUuid> ids(4097);
+    auto generated = std::async(std::launch::async, [&ids, time]() {
+        Uuidv8Factory::createBatch(4096, ids.data());
+        Uuidv8Factory::setManualTime(time - 3600000);
+        Uuidv8Factory::createBatch(1, ids.data() + 4096);
+    });
+    auto status = generated.wait_for(std::chrono::seconds(5));
+    if (std::future_status::ready != status) {
+        // unblock the generating thread
+        Uuidv8Factory::setManualTime(time + 1);
+    }
+    generated.wait();
+    Uuidv8Factory::setClock(Uuidv8Factory::Clock::Realtime);
+
+    ASSERT_EQ(std::future_status::ready, status);
+    EXPECT_TRUE(isIncreasing(ids));
+    EXPECT_EQ(time, ids[0].getTime());
+    EXPECT_EQ(time + 1, ids[4096].getTime());
+}
+
+auto main(int argc, const char** argv) -> int {
+    ::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+    return RUN_ALL_TESTS();
+}